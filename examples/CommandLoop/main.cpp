@@ -69,7 +69,7 @@ class Context<boost::asio::io_service>
 
   void invoke(Action _action) {
     if (service_) {
-      service_->dispatch(_action);
+      service_->dispatch(std::move(_action));
     }
   }
 
@@ -0,0 +1,105 @@
+/**
+ * @file main.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Benchmark of parallel algorithms on ThreadPool.
+ * Prints time of serial baseline and speed up for 1 .. N threads
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <icc/threadpool/Parallel.hpp>
+
+namespace {
+
+const std::size_t kSize = 1 << 24;
+const int kNumRepeats = 5;
+
+template <typename TFunction>
+double measure(TFunction _function) {
+  double bestTime = 0;
+  for (int i = 0; i < kNumRepeats; ++i) {
+    const auto kStart = std::chrono::steady_clock::now();
+    _function();
+    const std::chrono::duration<double, std::milli> kTime =
+        std::chrono::steady_clock::now() - kStart;
+    if (i == 0 || kTime.count() < bestTime) {
+      bestTime = kTime.count();
+    }
+  }
+  return bestTime;
+}
+
+double heavy(double _value) {
+  return std::sqrt(_value) * std::sin(_value) + std::cos(_value);
+}
+
+void printRow(const std::string &_name, unsigned _numThreads,
+              double _time, double _serialTime) {
+  std::cout << std::setw(18) << _name
+            << std::setw(10) << _numThreads
+            << std::setw(14) << std::fixed << std::setprecision(2) << _time
+            << std::setw(10) << _serialTime / _time << "x" << std::endl;
+}
+
+}
+
+int main() {
+  std::vector<double> input(kSize);
+  std::iota(input.begin(), input.end(), 1.0);
+  std::vector<double> output(kSize);
+  std::vector<int> unsorted(kSize);
+  std::mt19937 generator{42};
+  for (auto &value : unsorted) {
+    value = static_cast<int>(generator());
+  }
+
+  const double kSerialTransform = measure([&] {
+    std::transform(input.begin(), input.end(), output.begin(), heavy);
+  });
+  const double kSerialReduce = measure([&] {
+    volatile double sum = std::accumulate(input.begin(), input.end(), 0.0);
+    (void) sum;
+  });
+  const double kSerialSort = measure([&] {
+    std::vector<int> values = unsorted;
+    std::sort(values.begin(), values.end());
+  });
+
+  std::cout << std::setw(18) << "algorithm"
+            << std::setw(10) << "threads"
+            << std::setw(14) << "time, ms"
+            << std::setw(11) << "speed up" << std::endl;
+  printRow("serial transform", 1, kSerialTransform, kSerialTransform);
+  printRow("serial reduce", 1, kSerialReduce, kSerialReduce);
+  printRow("serial sort", 1, kSerialSort, kSerialSort);
+
+  const unsigned kMaxThreads = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned numThreads = 1; numThreads <= kMaxThreads; numThreads *= 2) {
+    // NOTE(redra): Calling thread participates in work, so pool has one thread less
+    auto pool = icc::threadpool::ThreadPool::createPool(numThreads - 1);
+    printRow("parallelTransform", numThreads, measure([&] {
+      icc::threadpool::parallelTransform(*pool, input.begin(), input.end(), output.begin(), heavy);
+    }), kSerialTransform);
+    printRow("parallelReduce", numThreads, measure([&] {
+      volatile double sum = icc::threadpool::parallelReduce(*pool, input.begin(), input.end(),
+                                                            0.0, std::plus<double>());
+      (void) sum;
+    }), kSerialReduce);
+    printRow("parallelSort", numThreads, measure([&] {
+      std::vector<int> values = unsorted;
+      icc::threadpool::parallelSort(*pool, values.begin(), values.end());
+    }), kSerialSort);
+  }
+  return 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file Action.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains Action class.
+ * It is move-only replacement of std::function<void(void)> with
+ * inline storage for small callable objects. Typical lambdas pushed
+ * in Component are stored without heap allocation and are never copied
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_ACTION_HPP
+#define ICC_ACTION_HPP
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+namespace icc {
+
+class Action {
+  /**
+   * Whether TFunction could be called with signature void(void)
+   */
+  template <typename TFunction, typename = void>
+  struct IsCallable : std::false_type {
+  };
+
+  template <typename TFunction>
+  struct IsCallable<TFunction, decltype(void(std::declval<TFunction &>()()))>
+      : std::true_type {
+  };
+
+ public:
+  /**
+   * Size of inline storage, chosen so that Action fits in one cache line
+   */
+  static constexpr std::size_t kInlineSize = 64 - sizeof(void *);
+
+  Action() noexcept = default;
+
+  Action(std::nullptr_t) noexcept {
+  }
+
+  /**
+   * Constructor from any callable object with signature void(void).
+   * Callable is stored inline if it is small enough and nothrow movable
+   * @param _function Callable object
+   */
+  template <typename TFunction,
+            typename = typename std::enable_if<
+                !std::is_same<typename std::decay<TFunction>::type, Action>::value &&
+                IsCallable<typename std::decay<TFunction>::type>::value>::type>
+  Action(TFunction &&_function) {
+    using TDecayFunction = typename std::decay<TFunction>::type;
+    if (!isEmpty(_function)) {
+      initialize<TDecayFunction>(std::forward<TFunction>(_function),
+                                 std::integral_constant<bool, isInline<TDecayFunction>()>{});
+    }
+  }
+
+  Action(Action &&_other) noexcept {
+    moveFrom(_other);
+  }
+
+  Action &operator=(Action &&_other) noexcept {
+    if (this != &_other) {
+      reset();
+      moveFrom(_other);
+    }
+    return *this;
+  }
+
+  Action &operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+  }
+
+  /**
+   * Disable ability to copy Action class
+   */
+  Action(const Action &) = delete;
+  Action &operator=(const Action &) = delete;
+
+  ~Action() {
+    reset();
+  }
+
+  explicit operator bool() const noexcept {
+    return operations_ != nullptr;
+  }
+
+  void operator()() {
+    if (operations_ == nullptr) {
+      throw std::bad_function_call();
+    }
+    operations_->invoke_(storage_);
+  }
+
+ private:
+  union Storage {
+    void *heap_ptr_;
+    typename std::aligned_storage<kInlineSize, alignof(void *)>::type inline_;
+  };
+
+  struct Operations {
+    void (*invoke_)(Storage &);
+    void (*move_)(Storage &, Storage &);
+    void (*destroy_)(Storage &);
+  };
+
+  template <typename TFunction>
+  struct InlineOperations {
+    static TFunction * get(Storage &_storage) {
+      return reinterpret_cast<TFunction *>(&_storage.inline_);
+    }
+
+    static void invoke(Storage &_storage) {
+      (*get(_storage))();
+    }
+
+    static void move(Storage &_from, Storage &_to) {
+      new(&_to.inline_) TFunction(std::move(*get(_from)));
+      get(_from)->~TFunction();
+    }
+
+    static void destroy(Storage &_storage) {
+      get(_storage)->~TFunction();
+    }
+
+    static const Operations kOperations;
+  };
+
+  template <typename TFunction>
+  struct HeapOperations {
+    static TFunction * get(Storage &_storage) {
+      return static_cast<TFunction *>(_storage.heap_ptr_);
+    }
+
+    static void invoke(Storage &_storage) {
+      (*get(_storage))();
+    }
+
+    static void move(Storage &_from, Storage &_to) {
+      _to.heap_ptr_ = _from.heap_ptr_;
+      _from.heap_ptr_ = nullptr;
+    }
+
+    static void destroy(Storage &_storage) {
+      delete get(_storage);
+    }
+
+    static const Operations kOperations;
+  };
+
+  template <typename TFunction>
+  static constexpr bool isInline() {
+    return sizeof(TFunction) <= sizeof(Storage) &&
+           alignof(Storage) % alignof(TFunction) == 0 &&
+           std::is_nothrow_move_constructible<TFunction>::value;
+  }
+
+  template <typename TFunction>
+  static bool isEmpty(const TFunction &) {
+    return false;
+  }
+
+  template <typename TSignature>
+  static bool isEmpty(const std::function<TSignature> &_function) {
+    return !_function;
+  }
+
+  template <typename TResult, typename ... TArgs>
+  static bool isEmpty(TResult (*_function)(TArgs...)) {
+    return _function == nullptr;
+  }
+
+  template <typename TDecayFunction, typename TFunction>
+  void initialize(TFunction &&_function, std::true_type) {
+    new(&storage_.inline_) TDecayFunction(std::forward<TFunction>(_function));
+    operations_ = &InlineOperations<TDecayFunction>::kOperations;
+  }
+
+  template <typename TDecayFunction, typename TFunction>
+  void initialize(TFunction &&_function, std::false_type) {
+    storage_.heap_ptr_ = new TDecayFunction(std::forward<TFunction>(_function));
+    operations_ = &HeapOperations<TDecayFunction>::kOperations;
+  }
+
+  void moveFrom(Action &_other) noexcept {
+    if (_other.operations_ != nullptr) {
+      _other.operations_->move_(_other.storage_, storage_);
+      operations_ = _other.operations_;
+      _other.operations_ = nullptr;
+    }
+  }
+
+  void reset() noexcept {
+    if (operations_ != nullptr) {
+      operations_->destroy_(storage_);
+      operations_ = nullptr;
+    }
+  }
+
+  const Operations *operations_ = nullptr;
+  Storage storage_;
+};
+
+template <typename TFunction>
+const Action::Operations Action::InlineOperations<TFunction>::kOperations = {
+    &Action::InlineOperations<TFunction>::invoke,
+    &Action::InlineOperations<TFunction>::move,
+    &Action::InlineOperations<TFunction>::destroy,
+};
+
+template <typename TFunction>
+const Action::Operations Action::HeapOperations<TFunction>::kOperations = {
+    &Action::HeapOperations<TFunction>::invoke,
+    &Action::HeapOperations<TFunction>::move,
+    &Action::HeapOperations<TFunction>::destroy,
+};
+
+}
+
+#endif //ICC_ACTION_HPP
@@ -146,31 +146,131 @@ class Component {
       if (parent_) {
         parent_->removeChild(this);
       }
-    });
+    }, Priority::High);
   }
 
   /**
    * Method used to push task for execution
    * @param _task Task that will be executed
    */
-  virtual void push(std::function<void(void)> _task) {
+  virtual void push(Action _task) {
     if (channel_) {
       channel_->push(std::move(_task));
     }
   }
 
+  /**
+   * Method used to push task that should be executed before _deadline.
+   * Context that does not support deadlines executes it as usual task
+   * @param _task Task that will be executed
+   * @param _deadline Absolute deadline of task
+   */
+  virtual void push(Action _task, Deadline _deadline) {
+    if (channel_) {
+      channel_->push(std::move(_task), _deadline);
+    }
+  }
+
+  /**
+   * Method used to push several tasks for execution at once.
+   * Tasks are enqueued with single synchronization and single wake up
+   * @param _tasks Tasks that will be executed in order
+   */
+  virtual void pushBatch(std::vector<Action> _tasks) {
+    if (channel_) {
+      channel_->pushBatch(std::move(_tasks));
+    }
+  }
+
+  /**
+   * Method used to push task that will be executed once after _delay
+   * @param _delay Delay of task
+   * @param _task Task that will be executed
+   * @return Handle used to cancel task
+   */
+  virtual TimerHandle pushAfter(TimerClock::duration _delay, Action _task) {
+    if (channel_) {
+      return channel_->pushAfter(_delay, std::move(_task));
+    }
+    return TimerHandle{};
+  }
+
+  /**
+   * Method used to push task that will be executed once at _timePoint
+   * @param _timePoint Time point of task
+   * @param _task Task that will be executed
+   * @return Handle used to cancel task
+   */
+  virtual TimerHandle pushAt(TimerClock::time_point _timePoint, Action _task) {
+    if (channel_) {
+      return channel_->pushAt(_timePoint, std::move(_task));
+    }
+    return TimerHandle{};
+  }
+
+  /**
+   * Method used to push task that will be executed every _period
+   * until returned handle is cancelled
+   * @param _period Period of task
+   * @param _task Task that will be executed
+   * @return Handle used to cancel task
+   */
+  virtual TimerHandle pushEvery(TimerClock::duration _period, Action _task) {
+    if (channel_) {
+      return channel_->pushEvery(_period, std::move(_task));
+    }
+    return TimerHandle{};
+  }
+
+  /**
+   * Method used to push task for execution and to get
+   * feedback from bounded context mailbox
+   * @param _task Task that will be executed
+   * @return Result of pushing
+   */
+  virtual PushResult tryPush(Action _task) {
+    if (channel_) {
+      return channel_->tryPush(std::move(_task));
+    }
+    return PushResult::Rejected;
+  }
+
   /**
    * Method used to call task in this thread if
    * current context is io::service itself otherwise
    * push it in queue
    * @param _task Task that will be executed
    */
-  virtual void invoke(std::function<void(void)> _task) {
+  virtual void invoke(Action _task) {
     if (channel_) {
       channel_->invoke(std::move(_task));
     }
   }
 
+  /**
+   * Method used to push task for execution with priority
+   * @param _task Task that will be executed
+   * @param _priority Priority of task
+   */
+  virtual void push(Action _task, Priority _priority) {
+    if (channel_) {
+      channel_->push(std::move(_task), _priority);
+    }
+  }
+
+  /**
+   * Method used to call task in this thread if
+   * current context is io::service itself otherwise
+   * push it in queue with priority
+   * @param _task Task that will be executed
+   * @param _priority Priority of task
+   */
+  virtual void invoke(Action _task, Priority _priority) {
+    if (channel_) {
+      channel_->invoke(std::move(_task), _priority);
+    }
+  }
+
  protected:
   /**
    * Override this method if you need to track finishing of child classes
@@ -199,7 +299,7 @@ class Component {
     if (_child) {
       invoke([=] {
         children_.push_back(_child);
-      });
+      }, Priority::High);
     }
   }
 
@@ -217,7 +317,7 @@ class Component {
           children_.erase(childIter);
           onChildExit(_child);
         }
-      });
+      }, Priority::High);
     }
   }
 
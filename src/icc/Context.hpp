@@ -9,6 +9,19 @@
  * It is default implementation of IContext interface
  * based on ThreadSafeQueue. This implementation is used in Component as
  * default Context
+ * Contains Context<MpscQueueAction>:
+ * It is implementation of IContext interface based on lock-free
+ * MpscQueue. Could be used for Components with high rate of messages
+ * Mailbox of Context<ThreadSafeActionQueue> could be bounded with one of
+ * OverflowPolicy to apply backpressure to producers. Actions pushed with
+ * Priority::High are executed before bulk actions with Priority::Normal
+ * Contains Context<DeadlineQueueAction>:
+ * It is implementation of IContext interface that executes actions in
+ * earliest-deadline-first order and could shed actions that missed deadline.
+ * Actions without deadline are interleaved with them, actions pushed with
+ * Priority::High are executed before both
+ * Context<ThreadSafeActionQueue> and Context<MpscQueueAction> support delayed
+ * and periodic actions, run loop checks them using timeout of waiting for mailbox
  * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
  */
 
@@ -18,13 +31,19 @@
 #include <atomic>
 #include <thread>
 #include <functional>
+#include <stdexcept>
 #include <utility>
+#include <vector>
+#include <icc/Action.hpp>
+#include <icc/ContextStats.hpp>
+#include <icc/_private/helpers/stats_helpers.hpp>
+#include <icc/_private/helpers/timer_helpers.hpp>
 #include <icc/_private/containers/ThreadSafeQueue.hpp>
+#include <icc/_private/containers/MpscQueue.hpp>
+#include <icc/_private/containers/DeadlineQueue.hpp>
 
 namespace icc {
 
-using Action = std::function<void(void)>;
-
 template <typename TService>
 class Context;
 
@@ -33,6 +52,14 @@ enum class ExecPolicy {
   UntilWorkers,
 };
 
+using OverflowPolicy = _private::containers::OverflowPolicy;
+using PushResult = _private::containers::PushResult;
+using Priority = _private::containers::Priority;
+using Deadline = _private::containers::Deadline;
+using TimerClock = _private::containers::TimerClock;
+using TimerHandle = _private::containers::TimerHandle;
+using OverrunPolicy = _private::containers::OverrunPolicy;
+
 class IContext {
  public:
   class IChannel {
@@ -40,6 +67,92 @@ class IContext {
     virtual ~IChannel() = 0;
     virtual void push(Action _action) = 0;
     virtual void invoke(Action _action) = 0;
+
+    /**
+     * Pushes action and reports whether it was accepted by context.
+     * By default context mailbox is unbounded and action is always pushed
+     * @param _action Action to push
+     * @return Result of pushing
+     */
+    virtual PushResult tryPush(Action _action) {
+      push(std::move(_action));
+      return PushResult::Pushed;
+    }
+
+    /**
+     * Pushes action in priority lane of context.
+     * By default context has single lane and priority is ignored
+     * @param _action Action to push
+     * @param _priority Priority of action
+     */
+    virtual void push(Action _action, Priority _priority) {
+      push(std::move(_action));
+    }
+
+    /**
+     * Invokes action in place if called from context thread,
+     * otherwise pushes it in priority lane of context
+     * @param _action Action to invoke
+     * @param _priority Priority of action
+     */
+    virtual void invoke(Action _action, Priority _priority) {
+      invoke(std::move(_action));
+    }
+
+    /**
+     * Pushes action that should be executed before absolute _deadline.
+     * By default context does not support deadlines and action is pushed as usual
+     * @param _action Action to push
+     * @param _deadline Deadline of action
+     */
+    virtual void push(Action _action, Deadline _deadline) {
+      push(std::move(_action));
+    }
+
+    /**
+     * Pushes actions in FIFO order relative to other pushes.
+     * Contexts that support it enqueue whole batch
+     * under single synchronization with single wake up
+     * @param _actions Actions to push
+     */
+    virtual void pushBatch(std::vector<Action> _actions) {
+      for (auto &action : _actions) {
+        push(std::move(action));
+      }
+    }
+
+    /**
+     * Pushes action that is executed once after _delay
+     * @param _delay Delay of action
+     * @param _action Action to push
+     * @return Handle used to cancel action
+     */
+    virtual TimerHandle pushAfter(TimerClock::duration _delay, Action _action) {
+      return pushAt(TimerClock::now() + _delay, std::move(_action));
+    }
+
+    /**
+     * Pushes action that is executed once at _timePoint.
+     * By default context has no timers and std::logic_error is thrown
+     * @param _timePoint Time point of action
+     * @param _action Action to push
+     * @return Handle used to cancel action
+     */
+    virtual TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) {
+      throw std::logic_error("Context does not support timers !!");
+    }
+
+    /**
+     * Pushes action that is executed every _period until it is cancelled.
+     * By default context has no timers and std::logic_error is thrown
+     * @param _period Period of action
+     * @param _action Action to push
+     * @return Handle used to cancel action
+     */
+    virtual TimerHandle pushEvery(TimerClock::duration _period, Action _action) {
+      throw std::logic_error("Context does not support timers !!");
+    }
+
 #if __cpp_lib_optional >= 201606L
     [[nodiscard]]
 #endif
@@ -64,6 +177,27 @@ class ContextBase : public IContext {
   virtual void stop() = 0;
   virtual std::thread::id getThreadId() const = 0;
   virtual bool isRun() const = 0;
+
+  /**
+   * Switches collecting of runtime metrics.
+   * While enabled each pushed action remembers time of push in node of queue,
+   * when disabled actions are pushed without any overhead.
+   * Only ThreadSafeQueueContext and MpscQueueContext collect metrics,
+   * other contexts (DeadlineQueueContext, StrandContext, EventLoopContext)
+   * ignore this call and report ContextStats with enabled_ equal to false
+   * @param _enable Whether metrics should be collected
+   */
+  virtual void enableStats(bool _enable) {
+  }
+
+  /**
+   * Method used to get snapshot of runtime metrics.
+   * Could be called from any thread, does not lock Context
+   * @return Snapshot of metrics
+   */
+  virtual ContextStats stats() const {
+    return ContextStats{};
+  }
 };
 
 class ContextBuilder {
@@ -107,9 +241,13 @@ template <>
 class Context<ThreadSafeQueueAction> final
     : public ContextBase
     , public std::enable_shared_from_this<Context<ThreadSafeQueueAction>> {
+  using Mailbox = icc::_private::containers::ThreadSafeQueue<helpers::StampedAction>;
+
  public:
   class Channel : public IContext::IChannel {
    public:
+    using IContext::IChannel::push;
+
     explicit Channel(std::shared_ptr<Context> context)
       : context_{std::move(context)} {
       context_->num_of_channels_.fetch_add(1, std::memory_order_acq_rel);
@@ -134,6 +272,364 @@ class Context<ThreadSafeQueueAction> final
       }
     }
 
+    void push(Action _action, Priority _priority) override {
+      if (context_) {
+        context_->push(std::move(_action), _priority);
+      }
+    }
+
+    void invoke(Action _action, Priority _priority) override {
+      if (context_) {
+        context_->invoke(std::move(_action), _priority);
+      }
+    }
+
+    void pushBatch(std::vector<Action> _actions) override {
+      if (context_) {
+        context_->pushBatch(std::move(_actions));
+      }
+    }
+
+    PushResult tryPush(Action _action) override {
+      if (context_) {
+        return context_->push(std::move(_action));
+      }
+      return PushResult::Rejected;
+    }
+
+    TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) override {
+      if (context_) {
+        return context_->pushAt(_timePoint, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+    TimerHandle pushEvery(TimerClock::duration _period, Action _action) override {
+      if (context_) {
+        return context_->pushEvery(_period, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+#if __cpp_lib_optional >= 201606L
+    [[nodiscard]]
+#endif
+    IContext & getContext() const override {
+      return *context_;
+    }
+
+   private:
+    std::shared_ptr<Context> context_;
+  };
+
+  PushResult push(Action _action, Priority _priority = Priority::Normal) {
+    // NOTE(redra): Context thread is never blocked by its own full mailbox,
+    //  otherwise it would wait for itself
+    const bool kCanBlock = queue_thread_id_.load(std::memory_order_acquire) !=
+                           std::this_thread::get_id();
+    const bool kIsStatsEnabled = stats_recorder_.isEnabled();
+    helpers::StampedAction item{std::move(_action)};
+    if (kIsStatsEnabled) {
+      stats_recorder_.stamp(item);
+    }
+    const PushResult kResult = queue_->tryPush(std::move(item), kCanBlock, _priority);
+    if (kResult == PushResult::NoMemory) {
+      throw std::bad_alloc();
+    }
+    if (kIsStatsEnabled && kResult != PushResult::Pushed) {
+      stats_recorder_.onDrop();
+    }
+    return kResult;
+  }
+
+  /**
+   * Pushes actions under single lock of queue with single wake up
+   * @param _actions Actions to push
+   * @param _priority Priority of actions
+   */
+  void pushBatch(std::vector<Action> _actions, Priority _priority = Priority::Normal) {
+    const bool kCanBlock = queue_thread_id_.load(std::memory_order_acquire) !=
+                           std::this_thread::get_id();
+    if (!stats_recorder_.isEnabled()) {
+      queue_->pushBatch(_actions.begin(), _actions.end(), kCanBlock, _priority);
+      return;
+    }
+    std::vector<helpers::StampedAction> items;
+    items.reserve(_actions.size());
+    for (auto &action : _actions) {
+      items.emplace_back(std::move(action));
+      stats_recorder_.stamp(items.back());
+    }
+    const std::size_t kNumPushed = queue_->pushBatch(items.begin(), items.end(),
+                                                     kCanBlock, _priority);
+    for (std::size_t i = kNumPushed; i < items.size(); ++i) {
+      stats_recorder_.onDrop();
+    }
+  }
+
+  void invoke(Action _action, Priority _priority = Priority::Normal) {
+    if (queue_thread_id_.load(std::memory_order_acquire) ==
+        std::this_thread::get_id()) {
+      _action();
+    } else {
+      push(std::move(_action), _priority);
+    }
+  }
+
+  /**
+   * Pushes action that is executed once at _timePoint
+   * @param _timePoint Time point of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) {
+    return addTimer(std::move(_action), _timePoint, TimerClock::duration::zero());
+  }
+
+  TimerHandle pushAfter(TimerClock::duration _delay, Action _action) {
+    return pushAt(TimerClock::now() + _delay, std::move(_action));
+  }
+
+  /**
+   * Pushes action that is executed every _period until it is cancelled
+   * @param _period Period of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushEvery(TimerClock::duration _period, Action _action) {
+    return addTimer(std::move(_action), TimerClock::now() + _period, _period);
+  }
+
+  /**
+   * Bounds mailbox of context
+   * @param _capacity Maximum number of pending actions, 0 means unbounded mailbox
+   * @param _policy Policy applied when action is pushed in full mailbox
+   */
+  void setCapacity(std::size_t _capacity, OverflowPolicy _policy = OverflowPolicy::Block) {
+    queue_->setCapacity(_capacity, _policy);
+  }
+
+  /**
+   * Sets callbacks that are called when number of pending actions
+   * reaches _high and when it falls back to _low.
+   * Callbacks are called from thread that pushes or executes actions
+   * @param _high High watermark, 0 disables watermarks
+   * @param _low Low watermark
+   * @param _onHigh Callback for high watermark
+   * @param _onLow Callback for low watermark
+   */
+  void setWatermarks(std::size_t _high, std::size_t _low,
+                     std::function<void(void)> _onHigh,
+                     std::function<void(void)> _onLow) {
+    queue_->setWatermarks(_high, _low, std::move(_onHigh), std::move(_onLow));
+  }
+
+  /**
+   * Preallocates nodes in queue, so that pushing of up to
+   * _numActions pending actions does not allocate memory
+   * @param _numActions Number of actions to reserve space for
+   */
+  void reserve(std::size_t _numActions) {
+    queue_->reserve(_numActions);
+  }
+
+  /**
+   * Sets number of iterations that context thread busy waits for new action
+   * before falling asleep. Spinning reduces latency of wake up for
+   * ping-pong exchanges at the cost of processor time
+   * @param _spinCount Number of iterations, 0 disables spinning
+   */
+  void setSpinCount(unsigned _spinCount) {
+    queue_->setSpinCount(_spinCount);
+  }
+
+  /**
+   * Sets maximum number of actions that run loop takes from queue
+   * under single lock. By default actions are taken one by one
+   * @param _maxBatchSize Maximum size of batch, 0 means all pending actions
+   */
+  void setMaxBatchSize(std::size_t _maxBatchSize) {
+    max_batch_size_.store(_maxBatchSize, std::memory_order_release);
+  }
+
+  void run(ExecPolicy _policy = ExecPolicy::Forever) override {
+    std::thread::id defaultThreadId;
+    if (queue_thread_id_.compare_exchange_strong(defaultThreadId, std::this_thread::get_id())) {
+      bool stopState = false;
+      if (run_.compare_exchange_strong(stopState, true)) {
+        switch (_policy) {
+          case ExecPolicy::Forever: {
+            runForever();
+          }
+            break;
+          case ExecPolicy::UntilWorkers: {
+            runUntilWorkers();
+          }
+            break;
+        }
+      }
+    }
+  }
+
+  void stop() override {
+    auto thisThread = std::this_thread::get_id();
+    if (queue_thread_id_.compare_exchange_strong(thisThread, std::thread::id())) {
+      bool executeState = true;
+      if (run_.compare_exchange_strong(executeState, false)) {
+        queue_->interrupt();
+      }
+    }
+  }
+
+  std::unique_ptr<IChannel> createChannel() override {
+    return std::unique_ptr<Channel>(new Channel{shared_from_this()});
+  }
+
+  std::thread::id getThreadId() const override {
+    return queue_thread_id_.load(std::memory_order_acquire);
+  }
+
+  bool isRun() const override {
+    return run_.load(std::memory_order_acquire);
+  }
+
+  void enableStats(bool _enable) override {
+    stats_recorder_.enable(_enable);
+  }
+
+  ContextStats stats() const override {
+    return stats_recorder_.snapshot();
+  }
+
+ private:
+  TimerHandle addTimer(Action _action, TimerClock::time_point _timePoint,
+                       TimerClock::duration _period) {
+    TimerHandle handle = TimerHandle::create();
+    if (queue_thread_id_.load(std::memory_order_acquire) ==
+        std::this_thread::get_id()) {
+      timers_.add(std::move(_action), _timePoint, _period, handle);
+    } else {
+      // NOTE(redra): Timers are owned by context thread, so timer is added through mailbox
+      const PushResult kResult = push(helpers::ContextTimers::AddTimerAction{
+          timers_, std::move(_action), _timePoint, _period, handle}, Priority::High);
+      if (kResult == PushResult::Rejected || kResult == PushResult::DroppedNewest) {
+        handle.cancel();
+      }
+    }
+    return handle;
+  }
+
+  void runForever() {
+    do {
+      queue_->reset();
+      const TimerClock::time_point kNextTimer = timers_.executeExpired();
+      const std::size_t kMaxBatchSize = max_batch_size_.load(std::memory_order_acquire);
+      if (kMaxBatchSize == 1) {
+        helpers::StampedAction item = queue_->waitPop(kNextTimer);
+        stats_recorder_.execute(item);
+      } else {
+        queue_->waitDrain([this](helpers::StampedAction _item) {
+          stats_recorder_.execute(_item);
+          return run_.load(std::memory_order_acquire);
+        }, kMaxBatchSize, kNextTimer);
+      }
+    } while (run_.load(std::memory_order_acquire));
+  }
+
+  void runUntilWorkers() {
+    do {
+      queue_->reset();
+      const TimerClock::time_point kNextTimer = timers_.executeExpired();
+      const std::size_t kMaxBatchSize = max_batch_size_.load(std::memory_order_acquire);
+      if (kMaxBatchSize == 1) {
+        helpers::StampedAction item = queue_->waitPop(kNextTimer);
+        if (!queue_->isInterrupt()) {
+          stats_recorder_.execute(item);
+        }
+      } else {
+        queue_->waitDrain([this](helpers::StampedAction _item) {
+          if (queue_->isInterrupt()) {
+            return false;
+          }
+          stats_recorder_.execute(_item);
+          return run_.load(std::memory_order_acquire);
+        }, kMaxBatchSize, kNextTimer);
+      }
+    } while (run_.load(std::memory_order_acquire) &&
+             num_of_channels_.load(std::memory_order_acquire) > 0);
+  }
+
+  std::atomic<bool> run_{false};
+  std::atomic<unsigned> num_of_channels_{0};
+  std::atomic<std::size_t> max_batch_size_{1};
+  std::atomic<std::thread::id> queue_thread_id_;
+  helpers::StatsRecorder stats_recorder_;
+  helpers::ContextTimers timers_;
+  // NOTE(redra): Time of push is kept in node of mailbox, see helpers::StampedAction
+  std::unique_ptr<Mailbox> queue_{new Mailbox()};
+};
+
+using ThreadSafeQueueContext = Context<ThreadSafeQueueAction>;
+using DefaultContext = ThreadSafeQueueContext;
+
+using MpscQueueAction = icc::_private::containers::MpscQueue<Action>;
+
+template <>
+class Context<MpscQueueAction> final
+    : public ContextBase
+    , public std::enable_shared_from_this<Context<MpscQueueAction>> {
+  using Mailbox = icc::_private::containers::MpscQueue<helpers::StampedAction>;
+
+ public:
+  class Channel : public IContext::IChannel {
+   public:
+    using IContext::IChannel::push;
+    using IContext::IChannel::invoke;
+
+    explicit Channel(std::shared_ptr<Context> context)
+      : context_{std::move(context)} {
+      context_->num_of_channels_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    ~Channel() override {
+      const uint32_t kPrevNumWorkers = context_->num_of_channels_.fetch_sub(1, std::memory_order_acq_rel);
+      if (1 == kPrevNumWorkers) {
+        context_->queue_->interrupt();
+      }
+    }
+
+    void push(Action _action) override {
+      if (context_) {
+        context_->push(std::move(_action));
+      }
+    }
+
+    void invoke(Action _action) override {
+      if (context_) {
+        context_->invoke(std::move(_action));
+      }
+    }
+
+    void pushBatch(std::vector<Action> _actions) override {
+      if (context_) {
+        context_->pushBatch(std::move(_actions));
+      }
+    }
+
+    TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) override {
+      if (context_) {
+        return context_->pushAt(_timePoint, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+    TimerHandle pushEvery(TimerClock::duration _period, Action _action) override {
+      if (context_) {
+        return context_->pushEvery(_period, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
 #if __cpp_lib_optional >= 201606L
     [[nodiscard]]
 #endif
@@ -146,18 +642,332 @@ class Context<ThreadSafeQueueAction> final
   };
 
   void push(Action _action) {
-    queue_->push(std::move(_action));
+    helpers::StampedAction item{std::move(_action)};
+    if (stats_recorder_.isEnabled()) {
+      stats_recorder_.stamp(item);
+    }
+    queue_->push(std::move(item));
+  }
+
+  /**
+   * Pushes actions with single exchange of queue head and single wake up
+   * @param _actions Actions to push
+   */
+  void pushBatch(std::vector<Action> _actions) {
+    if (!stats_recorder_.isEnabled()) {
+      queue_->pushBatch(_actions.begin(), _actions.end());
+      return;
+    }
+    std::vector<helpers::StampedAction> items;
+    items.reserve(_actions.size());
+    for (auto &action : _actions) {
+      items.emplace_back(std::move(action));
+      stats_recorder_.stamp(items.back());
+    }
+    queue_->pushBatch(items.begin(), items.end());
   }
 
   void invoke(Action _action) {
     if (queue_thread_id_.load(std::memory_order_acquire) ==
         std::this_thread::get_id()) {
       _action();
+    } else {
+      push(std::move(_action));
+    }
+  }
+
+  /**
+   * Pushes action that is executed once at _timePoint
+   * @param _timePoint Time point of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) {
+    return addTimer(std::move(_action), _timePoint, TimerClock::duration::zero());
+  }
+
+  TimerHandle pushAfter(TimerClock::duration _delay, Action _action) {
+    return pushAt(TimerClock::now() + _delay, std::move(_action));
+  }
+
+  /**
+   * Pushes action that is executed every _period until it is cancelled
+   * @param _period Period of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushEvery(TimerClock::duration _period, Action _action) {
+    return addTimer(std::move(_action), TimerClock::now() + _period, _period);
+  }
+
+  void run(ExecPolicy _policy = ExecPolicy::Forever) override {
+    std::thread::id defaultThreadId;
+    if (queue_thread_id_.compare_exchange_strong(defaultThreadId, std::this_thread::get_id())) {
+      bool stopState = false;
+      if (run_.compare_exchange_strong(stopState, true)) {
+        switch (_policy) {
+          case ExecPolicy::Forever: {
+            runForever();
+          }
+            break;
+          case ExecPolicy::UntilWorkers: {
+            runUntilWorkers();
+          }
+            break;
+        }
+      }
+    }
+  }
+
+  void stop() override {
+    auto thisThread = std::this_thread::get_id();
+    if (queue_thread_id_.compare_exchange_strong(thisThread, std::thread::id())) {
+      bool executeState = true;
+      if (run_.compare_exchange_strong(executeState, false)) {
+        queue_->interrupt();
+      }
+    }
+  }
+
+  std::unique_ptr<IChannel> createChannel() override {
+    return std::unique_ptr<Channel>(new Channel{shared_from_this()});
+  }
+
+  std::thread::id getThreadId() const override {
+    return queue_thread_id_.load(std::memory_order_acquire);
+  }
+
+  bool isRun() const override {
+    return run_.load(std::memory_order_acquire);
+  }
+
+  void enableStats(bool _enable) override {
+    stats_recorder_.enable(_enable);
+  }
+
+  ContextStats stats() const override {
+    return stats_recorder_.snapshot();
+  }
+
+ private:
+  TimerHandle addTimer(Action _action, TimerClock::time_point _timePoint,
+                       TimerClock::duration _period) {
+    TimerHandle handle = TimerHandle::create();
+    if (queue_thread_id_.load(std::memory_order_acquire) ==
+        std::this_thread::get_id()) {
+      timers_.add(std::move(_action), _timePoint, _period, handle);
+    } else {
+      // NOTE(redra): Timers are owned by context thread, so timer is added through mailbox
+      push(helpers::ContextTimers::AddTimerAction{
+          timers_, std::move(_action), _timePoint, _period, handle});
+    }
+    return handle;
+  }
+
+  void runForever() {
+    do {
+      queue_->reset();
+      helpers::StampedAction item = queue_->waitPop(timers_.executeExpired());
+      stats_recorder_.execute(item);
+    } while (run_.load(std::memory_order_acquire));
+  }
+
+  void runUntilWorkers() {
+    do {
+      queue_->reset();
+      helpers::StampedAction item = queue_->waitPop(timers_.executeExpired());
+      if (!queue_->isInterrupt()) {
+        stats_recorder_.execute(item);
+      }
+    } while (run_.load(std::memory_order_acquire) &&
+             num_of_channels_.load(std::memory_order_acquire) > 0);
+  }
+
+  std::atomic<bool> run_{false};
+  std::atomic<unsigned> num_of_channels_{0};
+  std::atomic<std::thread::id> queue_thread_id_;
+  helpers::StatsRecorder stats_recorder_;
+  helpers::ContextTimers timers_;
+  // NOTE(redra): Time of push is kept in node of mailbox, see helpers::StampedAction
+  std::unique_ptr<Mailbox> queue_{new Mailbox()};
+};
+
+using MpscQueueContext = Context<MpscQueueAction>;
+
+using DeadlineQueueAction = icc::_private::containers::DeadlineQueue<Action>;
+
+/**
+ * Policy that is applied to action that missed its deadline
+ */
+enum class ExpiryPolicy {
+  /**
+   * Action is executed late
+   */
+  Execute,
+  /**
+   * Action is dropped without execution
+   */
+  Drop,
+  /**
+   * Action is passed to expiry handler
+   */
+  Handle,
+};
+
+template <>
+class Context<DeadlineQueueAction> final
+    : public ContextBase
+    , public std::enable_shared_from_this<Context<DeadlineQueueAction>> {
+ public:
+  using ExpiryHandler = std::function<void(Action)>;
+
+  class Channel : public IContext::IChannel {
+   public:
+    using IContext::IChannel::push;
+
+    explicit Channel(std::shared_ptr<Context> context)
+      : context_{std::move(context)} {
+      context_->num_of_channels_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    ~Channel() override {
+      const uint32_t kPrevNumWorkers = context_->num_of_channels_.fetch_sub(1, std::memory_order_acq_rel);
+      if (1 == kPrevNumWorkers) {
+        context_->queue_->interrupt();
+      }
+    }
+
+    void push(Action _action) override {
+      if (context_) {
+        context_->push(std::move(_action));
+      }
+    }
+
+    void invoke(Action _action) override {
+      if (context_) {
+        context_->invoke(std::move(_action));
+      }
+    }
+
+    void push(Action _action, Priority _priority) override {
+      if (context_) {
+        context_->push(std::move(_action), _priority);
+      }
+    }
+
+    void invoke(Action _action, Priority _priority) override {
+      if (context_) {
+        context_->invoke(std::move(_action), _priority);
+      }
+    }
+
+    void push(Action _action, Deadline _deadline) override {
+      if (context_) {
+        context_->push(std::move(_action), _deadline);
+      }
+    }
+
+    TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) override {
+      if (context_) {
+        return context_->pushAt(_timePoint, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+    TimerHandle pushEvery(TimerClock::duration _period, Action _action) override {
+      if (context_) {
+        return context_->pushEvery(_period, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+#if __cpp_lib_optional >= 201606L
+    [[nodiscard]]
+#endif
+    IContext & getContext() const override {
+      return *context_;
+    }
+
+   private:
+    std::shared_ptr<Context> context_;
+  };
+
+  /**
+   * Pushes action, action without deadline is executed in FIFO order
+   * interleaved with actions with deadlines, so it is never starved by them
+   * @param _action Action to push
+   * @param _deadline Deadline of action
+   */
+  void push(Action _action, Deadline _deadline = DeadlineQueueAction::noDeadline()) {
+    queue_->push(std::move(_action), _deadline);
+  }
+
+  /**
+   * Pushes action without deadline, action with Priority::High
+   * is executed before any action with or without deadline
+   * @param _action Action to push
+   * @param _priority Priority of action
+   */
+  void push(Action _action, Priority _priority) {
+    if (Priority::High == _priority) {
+      queue_->pushUrgent(std::move(_action));
     } else {
       queue_->push(std::move(_action));
     }
   }
 
+  void invoke(Action _action, Priority _priority = Priority::Normal) {
+    if (queue_thread_id_.load(std::memory_order_acquire) ==
+        std::this_thread::get_id()) {
+      _action();
+    } else {
+      push(std::move(_action), _priority);
+    }
+  }
+
+  /**
+   * Pushes action that is executed once at _timePoint
+   * @param _timePoint Time point of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) {
+    return addTimer(std::move(_action), _timePoint, TimerClock::duration::zero());
+  }
+
+  TimerHandle pushAfter(TimerClock::duration _delay, Action _action) {
+    return pushAt(TimerClock::now() + _delay, std::move(_action));
+  }
+
+  /**
+   * Pushes action that is executed every _period until it is cancelled
+   * @param _period Period of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushEvery(TimerClock::duration _period, Action _action) {
+    return addTimer(std::move(_action), TimerClock::now() + _period, _period);
+  }
+
+  /**
+   * Sets what to do with actions that missed deadline.
+   * Should be set before run
+   * @param _policy Policy for expired actions
+   * @param _handler Handler for ExpiryPolicy::Handle, called on context thread
+   */
+  void setExpiryPolicy(ExpiryPolicy _policy, ExpiryHandler _handler = nullptr) {
+    expiry_policy_ = _policy;
+    expiry_handler_ = std::move(_handler);
+  }
+
+  /**
+   * Number of actions that missed deadline and were not executed
+   * @return Number of expired actions
+   */
+  std::uint64_t expiredCount() const {
+    return expired_count_.load(std::memory_order_relaxed);
+  }
+
   void run(ExecPolicy _policy = ExecPolicy::Forever) override {
     std::thread::id defaultThreadId;
     if (queue_thread_id_.compare_exchange_strong(defaultThreadId, std::this_thread::get_id())) {
@@ -200,12 +1010,44 @@ class Context<ThreadSafeQueueAction> final
   }
 
  private:
+  TimerHandle addTimer(Action _action, TimerClock::time_point _timePoint,
+                       TimerClock::duration _period) {
+    TimerHandle handle = TimerHandle::create();
+    if (queue_thread_id_.load(std::memory_order_acquire) ==
+        std::this_thread::get_id()) {
+      timers_.add(std::move(_action), _timePoint, _period, handle);
+    } else {
+      // NOTE(redra): Timers are owned by context thread, so timer is added through mailbox.
+      //  Urgent action is not delayed by actions with deadlines and is never expired,
+      //  so timer could not be late or lost by ExpiryPolicy
+      queue_->pushUrgent(helpers::ContextTimers::AddTimerAction{
+          timers_, std::move(_action), _timePoint, _period, handle});
+    }
+    return handle;
+  }
+
+  void execute(Action &_action, const Deadline _deadline) {
+    if (expiry_policy_ != ExpiryPolicy::Execute &&
+        _deadline != DeadlineQueueAction::noDeadline() &&
+        _deadline < Deadline::clock::now()) {
+      expired_count_.fetch_add(1, std::memory_order_relaxed);
+      if (expiry_policy_ == ExpiryPolicy::Handle && expiry_handler_) {
+        expiry_handler_(std::move(_action));
+      }
+      return;
+    }
+    if (_action) {
+      _action();
+    }
+  }
+
   void runForever() {
     do {
       queue_->reset();
-      Action action = queue_->waitPop();
-      if (action) {
-        action();
+      Action action;
+      Deadline deadline;
+      if (queue_->waitPop(action, deadline, timers_.executeExpired())) {
+        execute(action, deadline);
       }
     } while (run_.load(std::memory_order_acquire));
   }
@@ -213,9 +1055,10 @@ class Context<ThreadSafeQueueAction> final
   void runUntilWorkers() {
     do {
       queue_->reset();
-      Action action = queue_->waitPop();
-      if (!queue_->isInterrupt() && action) {
-        action();
+      Action action;
+      Deadline deadline;
+      if (queue_->waitPop(action, deadline, timers_.executeExpired())) {
+        execute(action, deadline);
       }
     } while (run_.load(std::memory_order_acquire) &&
              num_of_channels_.load(std::memory_order_acquire) > 0);
@@ -224,11 +1067,14 @@ class Context<ThreadSafeQueueAction> final
   std::atomic<bool> run_{false};
   std::atomic<unsigned> num_of_channels_{0};
   std::atomic<std::thread::id> queue_thread_id_;
-  std::unique_ptr<ThreadSafeQueueAction> queue_{new ThreadSafeQueueAction()};
+  std::atomic<std::uint64_t> expired_count_{0};
+  ExpiryPolicy expiry_policy_ = ExpiryPolicy::Execute;
+  ExpiryHandler expiry_handler_;
+  helpers::ContextTimers timers_;
+  std::unique_ptr<DeadlineQueueAction> queue_{new DeadlineQueueAction()};
 };
 
-using ThreadSafeQueueContext = Context<ThreadSafeQueueAction>;
-using DefaultContext = ThreadSafeQueueContext;
+using DeadlineQueueContext = Context<DeadlineQueueAction>;
 
 }
 
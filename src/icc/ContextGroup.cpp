@@ -0,0 +1,100 @@
+/**
+ * @file ContextGroup.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains implementation of ContextGroup class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <stdexcept>
+
+#include "ContextGroup.hpp"
+
+namespace icc {
+
+std::shared_ptr<ContextGroup> ContextGroup::createGroup(unsigned _numShards) {
+  if (_numShards == 0) {
+    _numShards = 1;
+  }
+  std::vector<ShardOptions> shardOptions(_numShards);
+  for (unsigned i = 0; i < _numShards; ++i) {
+    shardOptions[i].core_ = static_cast<int>(i);
+    shardOptions[i].name_ = "icc-shard-" + std::to_string(i);
+  }
+  return createGroup(std::move(shardOptions));
+}
+
+std::shared_ptr<ContextGroup> ContextGroup::createGroup(std::vector<ShardOptions> _shardOptions) {
+  if (_shardOptions.empty()) {
+    throw std::invalid_argument("ContextGroup should have at least one shard !!");
+  }
+  return std::shared_ptr<ContextGroup>(new ContextGroup(std::move(_shardOptions)));
+}
+
+ContextGroup::ContextGroup(std::vector<ShardOptions> _shardOptions) {
+  shards_.resize(_shardOptions.size());
+  for (std::size_t i = 0; i < shards_.size(); ++i) {
+    shards_[i].context_ = ContextBuilder::createContext<ThreadSafeQueueAction>();
+  }
+  for (std::size_t i = 0; i < shards_.size(); ++i) {
+    std::shared_ptr<ThreadSafeQueueContext> context = shards_[i].context_;
+    ShardOptions options = std::move(_shardOptions[i]);
+    shards_[i].thread_ = std::thread([context, options] {
+      // NOTE(redra): Tuning of thread is best effort, shard works even if OS refuses it
+      if (options.core_ >= 0) {
+        os::setCurrentThreadAffinity(static_cast<unsigned>(options.core_));
+      }
+      if (!options.name_.empty()) {
+        os::setCurrentThreadName(options.name_);
+      }
+      if (options.sched_policy_ != os::SchedPolicy::Default) {
+        os::setCurrentThreadSchedPolicy(options.sched_policy_, options.sched_priority_);
+      }
+      context->run(ExecPolicy::Forever);
+    });
+  }
+}
+
+ContextGroup::~ContextGroup() {
+  stop();
+}
+
+std::size_t ContextGroup::size() const {
+  return shards_.size();
+}
+
+std::shared_ptr<ThreadSafeQueueContext> ContextGroup::getContext(const std::size_t _shardIdx) const {
+  return shards_.at(_shardIdx).context_;
+}
+
+std::unique_ptr<IContext::IChannel> ContextGroup::createChannel(const std::size_t _shardIdx) const {
+  return shards_.at(_shardIdx).context_->createChannel();
+}
+
+std::unique_ptr<IContext::IChannel> ContextGroup::createChannelByHash(const std::size_t _hash) const {
+  return createChannel(_hash % shards_.size());
+}
+
+std::unique_ptr<IContext::IChannel> ContextGroup::createChannelRoundRobin() {
+  const std::size_t kShardIdx = next_shard_.fetch_add(1, std::memory_order_relaxed);
+  return createChannel(kShardIdx % shards_.size());
+}
+
+void ContextGroup::stop() {
+  for (auto &shard : shards_) {
+    if (shard.thread_.joinable()) {
+      std::shared_ptr<ThreadSafeQueueContext> context = shard.context_;
+      // NOTE(redra): Stop is pushed after pending actions, so they are executed
+      context->push([context] {
+        context->stop();
+      });
+    }
+  }
+  for (auto &shard : shards_) {
+    if (shard.thread_.joinable()) {
+      shard.thread_.join();
+    }
+  }
+}
+
+}
@@ -0,0 +1,128 @@
+/**
+ * @file ContextGroup.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains ContextGroup class.
+ * It is a fixed set of Contexts (shards), each of them is executed on
+ * its own thread that could be pinned to CPU core. Components are placed
+ * on shards by hash, by round-robin or explicitly, that gives
+ * thread-per-core deployment model
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_CONTEXTGROUP_HPP
+#define ICC_CONTEXTGROUP_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include <icc/Context.hpp>
+#include <icc/os/thread/Thread.hpp>
+#include <icc/_private/api.hpp>
+
+namespace icc {
+
+/**
+ * Options of thread that executes shard of ContextGroup
+ */
+struct ShardOptions {
+  /**
+   * CPU core to pin thread to, negative value means no pinning
+   */
+  int core_ = -1;
+  /**
+   * Name of thread, empty name means default name
+   */
+  std::string name_;
+  os::SchedPolicy sched_policy_ = os::SchedPolicy::Default;
+  int sched_priority_ = 0;
+};
+
+class ICC_PUBLIC ContextGroup {
+ public:
+  /**
+   * Creates group with shard per CPU core, shard i is pinned to core i
+   * @param _numShards Number of shards
+   * @return Group with running shards
+   */
+  static std::shared_ptr<ContextGroup> createGroup(
+      unsigned _numShards = std::thread::hardware_concurrency());
+
+  /**
+   * Creates group with shard per element of _shardOptions
+   * @param _shardOptions Options of each shard
+   * @return Group with running shards
+   */
+  static std::shared_ptr<ContextGroup> createGroup(std::vector<ShardOptions> _shardOptions);
+
+  ContextGroup(const ContextGroup &) = delete;
+  ContextGroup &operator=(const ContextGroup &) = delete;
+
+  /**
+   * Stops all shards and waits for their threads
+   */
+  ~ContextGroup();
+
+  std::size_t size() const;
+
+  /**
+   * Method used to get Context of shard
+   * @param _shardIdx Index of shard
+   * @return Context of shard
+   */
+  std::shared_ptr<ThreadSafeQueueContext> getContext(std::size_t _shardIdx) const;
+
+  /**
+   * Places Component explicitly on shard
+   * @param _shardIdx Index of shard
+   * @return Channel that should be passed to Component constructor
+   */
+  std::unique_ptr<IContext::IChannel> createChannel(std::size_t _shardIdx) const;
+
+  /**
+   * Places Component on shard by hash, the same hash is always placed on the same shard
+   * @param _hash Hash of key of Component
+   * @return Channel that should be passed to Component constructor
+   */
+  std::unique_ptr<IContext::IChannel> createChannelByHash(std::size_t _hash) const;
+
+  /**
+   * Places Component on shard by hash of _key
+   * @param _key Key of Component
+   * @return Channel that should be passed to Component constructor
+   */
+  template <typename TKey>
+  std::unique_ptr<IContext::IChannel> createChannelByKey(const TKey &_key) const {
+    return createChannelByHash(std::hash<TKey>{}(_key));
+  }
+
+  /**
+   * Places Component on next shard in round-robin order
+   * @return Channel that should be passed to Component constructor
+   */
+  std::unique_ptr<IContext::IChannel> createChannelRoundRobin();
+
+  /**
+   * Stops all shards and waits for their threads
+   */
+  void stop();
+
+ private:
+  explicit ContextGroup(std::vector<ShardOptions> _shardOptions);
+
+  struct Shard {
+    std::shared_ptr<ThreadSafeQueueContext> context_;
+    std::thread thread_;
+  };
+
+  std::vector<Shard> shards_;
+  std::atomic<std::size_t> next_shard_{0};
+};
+
+}
+
+#endif //ICC_CONTEXTGROUP_HPP
@@ -0,0 +1,68 @@
+/**
+ * @file ContextStats.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains ContextStats structure.
+ * It is snapshot of runtime metrics of Context: queue depth,
+ * time that actions wait in queue and time of their execution
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_CONTEXTSTATS_HPP
+#define ICC_CONTEXTSTATS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace icc {
+
+struct ContextStats {
+  /**
+   * Number of buckets in histograms. Bucket i counts values
+   * in range [2^i, 2^(i+1)), bucket 0 also counts zero values
+   */
+  static constexpr std::size_t kNumOfBuckets = 40;
+  using Histogram = std::array<std::uint64_t, kNumOfBuckets>;
+
+  /**
+   * Whether stats are collected, always false for contexts
+   * that do not support stats
+   */
+  bool enabled_ = false;
+  /**
+   * Time since stats were enabled
+   */
+  std::chrono::nanoseconds uptime_{0};
+  std::uint64_t pushed_actions_ = 0;
+  std::uint64_t executed_actions_ = 0;
+  std::uint64_t dropped_actions_ = 0;
+  /**
+   * Number of actions that wait for execution
+   */
+  std::uint64_t queue_depth_ = 0;
+  std::uint64_t max_queue_depth_ = 0;
+  /**
+   * Average number of executed actions per second since stats were enabled
+   */
+  double actions_per_second_ = 0.0;
+  std::chrono::nanoseconds total_wait_time_{0};
+  std::chrono::nanoseconds total_execution_time_{0};
+  /**
+   * Histogram of queue depth observed by pushed actions
+   */
+  Histogram queue_depth_histogram_{};
+  /**
+   * Histogram of time from push to start of execution in nanoseconds
+   */
+  Histogram wait_time_histogram_{};
+  /**
+   * Histogram of time of execution in nanoseconds
+   */
+  Histogram execution_time_histogram_{};
+};
+
+}
+
+#endif //ICC_CONTEXTSTATS_HPP
@@ -0,0 +1,230 @@
+/**
+ * @file DeadlineQueue.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains thread safe queue that pops items in
+ * earliest-deadline-first order
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_DEADLINE_QUEUE_HPP
+#define ICC_DEADLINE_QUEUE_HPP
+
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include <vector>
+
+#include "icc/_private/containers/exceptions/ContainerError.hpp"
+
+namespace icc {
+
+namespace _private {
+
+namespace containers {
+
+using Deadline = std::chrono::steady_clock::time_point;
+
+/**
+ * Binary heap of items ordered by deadline.
+ * Items with equal deadlines are popped in FIFO order.
+ * Items without deadline are kept in FIFO lane that is interleaved with heap,
+ * so steady stream of items with deadlines could not starve them.
+ * Urgent items are kept in FIFO lane that is popped before heap
+ */
+template<typename TItem>
+class DeadlineQueue {
+ public:
+  /**
+   * Deadline of items that could wait forever
+   */
+  static Deadline noDeadline() {
+    return Deadline::max();
+  }
+
+  DeadlineQueue() = default;
+  DeadlineQueue(const DeadlineQueue &) = delete;
+  DeadlineQueue &operator=(const DeadlineQueue &) = delete;
+
+  template<typename TAddItem>
+  void push(TAddItem &&item, const Deadline _deadline = noDeadline()) {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      if (noDeadline() == _deadline) {
+        fifo_items_.emplace_back(std::forward<TAddItem>(item));
+      } else {
+        entries_.push_back(Entry{_deadline, next_sequence_++, TItem(std::forward<TAddItem>(item))});
+        std::push_heap(entries_.begin(), entries_.end(), LaterEntry{});
+      }
+    }
+    cond_var_.notify_one();
+  }
+
+  /**
+   * Pushes item that is popped before any item with or without deadline.
+   * Used for control items that should not wait behind queued work
+   * @param item Item to push
+   */
+  template<typename TAddItem>
+  void pushUrgent(TAddItem &&item) {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      urgent_items_.emplace_back(std::forward<TAddItem>(item));
+    }
+    cond_var_.notify_one();
+  }
+
+  TItem pop() {
+    TItem item;
+    Deadline deadline;
+    if (!tryPop(item, deadline)) {
+      throw ContainerError("No items !!");
+    }
+    return item;
+  }
+
+  bool tryPop(TItem &item, Deadline &deadline) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return tryPop(lock, item, deadline);
+  }
+
+  /**
+   * Waits for item with the earliest deadline
+   * @param item Popped item
+   * @param deadline Deadline of popped item, noDeadline() for items without deadline
+   * @return true if item is popped, false if queue was interrupted
+   */
+  bool waitPop(TItem &item, Deadline &deadline) {
+    return waitPop(item, deadline, Deadline::max());
+  }
+
+  /**
+   * Waits for item with the earliest deadline until _until
+   * @param item Popped item
+   * @param deadline Deadline of popped item
+   * @param _until Time point after which waiting is stopped
+   * @return true if item is popped, false if queue was interrupted or time is out
+   */
+  bool waitPop(TItem &item, Deadline &deadline, const Deadline _until) {
+    std::unique_lock<std::mutex> lock{mtx_};
+    auto isReady = [this] {
+      return interrupted_.load(std::memory_order_acquire) ||
+             !isEmpty();
+    };
+    if (_until == Deadline::max()) {
+      cond_var_.wait(lock, isReady);
+    } else {
+      cond_var_.wait_until(lock, _until, isReady);
+    }
+    if (interrupted_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    return tryPop(lock, item, deadline);
+  }
+
+  bool isInterrupt() const {
+    return interrupted_.load(std::memory_order_acquire);
+  }
+
+  void interrupt() {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      interrupted_.store(true, std::memory_order_release);
+    }
+    cond_var_.notify_all();
+  }
+
+  void reset() {
+    interrupted_.store(false, std::memory_order_release);
+  }
+
+  bool empty() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return isEmpty();
+  }
+
+  std::size_t count() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return urgent_items_.size() + entries_.size() + fifo_items_.size();
+  }
+
+ private:
+  /**
+   * Number of items popped from heap in a row while items without
+   * deadline are waiting, after which one item without deadline is popped
+   */
+  static constexpr std::size_t kStarvationLimit = 64;
+
+  struct Entry {
+    Deadline deadline_;
+    std::uint64_t sequence_;
+    TItem item_;
+  };
+
+  /**
+   * Comparator that makes std heap functions keep the earliest entry on top
+   */
+  struct LaterEntry {
+    bool operator()(const Entry &_lhs, const Entry &_rhs) const {
+      if (_lhs.deadline_ != _rhs.deadline_) {
+        return _lhs.deadline_ > _rhs.deadline_;
+      }
+      return _lhs.sequence_ > _rhs.sequence_;
+    }
+  };
+
+  bool isEmpty() const {
+    return urgent_items_.empty() && entries_.empty() && fifo_items_.empty();
+  }
+
+  template<typename TLock>
+  bool tryPop(const TLock &lock, TItem &item, Deadline &deadline) {
+    if (!urgent_items_.empty()) {
+      item = std::move(urgent_items_.front());
+      deadline = noDeadline();
+      urgent_items_.pop_front();
+      return true;
+    }
+    if (!entries_.empty() &&
+        (fifo_items_.empty() || heap_streak_ < kStarvationLimit)) {
+      std::pop_heap(entries_.begin(), entries_.end(), LaterEntry{});
+      item = std::move(entries_.back().item_);
+      deadline = entries_.back().deadline_;
+      entries_.pop_back();
+      if (!fifo_items_.empty()) {
+        ++heap_streak_;
+      }
+      return true;
+    }
+    if (!fifo_items_.empty()) {
+      item = std::move(fifo_items_.front());
+      deadline = noDeadline();
+      fifo_items_.pop_front();
+      heap_streak_ = 0;
+      return true;
+    }
+    return false;
+  }
+
+  std::condition_variable cond_var_;
+  mutable std::mutex mtx_;
+  std::atomic<bool> interrupted_{false};
+  std::uint64_t next_sequence_ = 0;
+  std::size_t heap_streak_ = 0;
+  std::deque<TItem> urgent_items_;
+  std::vector<Entry> entries_;
+  std::deque<TItem> fifo_items_;
+};
+
+}
+
+}
+
+}
+
+#endif //ICC_DEADLINE_QUEUE_HPP
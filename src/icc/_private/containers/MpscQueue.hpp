@@ -0,0 +1,220 @@
+/**
+ * @file MpscQueue.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains lock-free queue for multiple providers and single consumer.
+ * Providers never take a lock, consumer parks on condition variable
+ * only when queue is empty
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_MPSC_QUEUE_HPP
+#define ICC_MPSC_QUEUE_HPP
+
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
+
+#include <icc/_private/helpers/cache_helpers.hpp>
+#include "icc/_private/containers/exceptions/ContainerError.hpp"
+
+namespace icc {
+
+namespace _private {
+
+namespace containers {
+
+/**
+ * Intrusive linked list queue in style of Dmitry Vyukov MPSC queue.
+ * push() and tryPush() could be called from any thread,
+ * tryPop(), waitPop() and empty() only from single consumer thread
+ */
+template<typename TItem>
+class MpscQueue {
+ public:
+  MpscQueue()
+    : tail_{new QueueNode()}
+    , head_{tail_} {
+  }
+
+  MpscQueue(const MpscQueue &) = delete;
+  MpscQueue &operator=(const MpscQueue &) = delete;
+
+  ~MpscQueue() {
+    TItem item;
+    while (tryPop(item));
+    delete tail_;
+  }
+
+  template<typename TAddItem>
+  void push(TAddItem &&item) {
+    if (!tryPush(std::forward<TAddItem>(item))) {
+      throw std::bad_alloc();
+    }
+  }
+
+  template<typename TAddItem>
+  bool tryPush(TAddItem &&item) noexcept {
+    auto *addNodePtr = new(std::nothrow) QueueNode(std::forward<TAddItem>(item));
+    if (addNodePtr == nullptr) {
+      return false;
+    }
+    QueueNode *const kPrevHeadNode = head_.exchange(addNodePtr, std::memory_order_acq_rel);
+    kPrevHeadNode->next_item_.store(addNodePtr, std::memory_order_seq_cst);
+    notifyConsumer();
+    return true;
+  }
+
+  /**
+   * Pushes range of items with single exchange of head and single notification.
+   * Items are moved from the range
+   * @param _first Iterator to the first item
+   * @param _last Iterator past the last item
+   */
+  template<typename TIterator>
+  void pushBatch(TIterator _first, TIterator _last) {
+    if (_first == _last) {
+      return;
+    }
+    QueueNode *const kFirstNode = new QueueNode(std::move(*_first));
+    QueueNode *lastNode = kFirstNode;
+    try {
+      for (++_first; _first != _last; ++_first) {
+        QueueNode *const kNodePtr = new QueueNode(std::move(*_first));
+        lastNode->next_item_.store(kNodePtr, std::memory_order_relaxed);
+        lastNode = kNodePtr;
+      }
+    } catch (...) {
+      QueueNode *nodePtr = kFirstNode;
+      while (nodePtr != nullptr) {
+        QueueNode *const kNextNode = nodePtr->next_item_.load(std::memory_order_relaxed);
+        delete nodePtr;
+        nodePtr = kNextNode;
+      }
+      throw;
+    }
+    QueueNode *const kPrevHeadNode = head_.exchange(lastNode, std::memory_order_acq_rel);
+    kPrevHeadNode->next_item_.store(kFirstNode, std::memory_order_seq_cst);
+    notifyConsumer();
+  }
+
+  TItem pop() {
+    TItem item;
+    if (!tryPop(item)) {
+      throw ContainerError("No items !!");
+    }
+    return item;
+  }
+
+  bool tryPop(TItem &item) {
+    QueueNode *const kNextNode = tail_->next_item_.load(std::memory_order_acquire);
+    if (kNextNode == nullptr) {
+      return false;
+    }
+    item = std::move(kNextNode->item_);
+    delete tail_;
+    tail_ = kNextNode;
+    return true;
+  }
+
+  TItem waitPop() {
+    return waitPop(std::chrono::steady_clock::time_point::max());
+  }
+
+  /**
+   * Waits for item until _until time point
+   * @param _until Time point when waiting is finished
+   * @return Popped item or default constructed item on timeout or interruption
+   */
+  TItem waitPop(const std::chrono::steady_clock::time_point _until) {
+    TItem item;
+    while (!interrupted_.load(std::memory_order_acquire) &&
+           !tryPop(item)) {
+      auto isReady = [this] {
+        return interrupted_.load(std::memory_order_acquire) ||
+               hasItems();
+      };
+      std::unique_lock<std::mutex> lock{mtx_};
+      sleeping_.store(true, std::memory_order_seq_cst);
+      bool isWokenUp = true;
+      if (_until == std::chrono::steady_clock::time_point::max()) {
+        cond_var_.wait(lock, isReady);
+      } else {
+        isWokenUp = cond_var_.wait_until(lock, _until, isReady);
+      }
+      sleeping_.store(false, std::memory_order_relaxed);
+      if (!isWokenUp) {
+        break;
+      }
+    }
+    return item;
+  }
+
+  bool isInterrupt() const {
+    return interrupted_.load(std::memory_order_acquire);
+  }
+
+  void interrupt() {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      interrupted_.store(true, std::memory_order_release);
+    }
+    cond_var_.notify_all();
+  }
+
+  void reset() {
+    interrupted_.store(false, std::memory_order_release);
+  }
+
+  bool empty() const {
+    return !hasItems();
+  }
+
+ private:
+  struct QueueNode {
+    QueueNode() = default;
+
+    template<typename TAddItem>
+    explicit QueueNode(TAddItem &&item)
+      : item_(std::forward<TAddItem>(item)) {
+    }
+
+    std::atomic<QueueNode *> next_item_{nullptr};
+    TItem item_;
+  };
+
+  bool hasItems() const {
+    return tail_->next_item_.load(std::memory_order_seq_cst) != nullptr;
+  }
+
+  void notifyConsumer() {
+    // NOTE(redra): Pairs with seq_cst store of sleeping_ in waitPop,
+    //  either consumer sees new node or we see that consumer is sleeping
+    if (sleeping_.load(std::memory_order_seq_cst)) {
+      {
+        std::lock_guard<std::mutex> lock{mtx_};
+      }
+      cond_var_.notify_one();
+    }
+  }
+
+  QueueNode *tail_;
+  char tail_padding_[icc::helpers::kCacheLineSize - sizeof(QueueNode *)];
+  std::atomic<QueueNode *> head_;
+  char head_padding_[icc::helpers::kCacheLineSize - sizeof(std::atomic<QueueNode *>)];
+  std::atomic<bool> sleeping_{false};
+  std::atomic<bool> interrupted_{false};
+  std::condition_variable cond_var_;
+  std::mutex mtx_;
+};
+
+}
+
+}
+
+}
+
+#endif //ICC_MPSC_QUEUE_HPP
@@ -10,11 +10,18 @@
 #define ICC_THREAD_SAFE_QUEUE_HPP
 
 #include <new>
+#include <cstddef>
+#include <cstdint>
 #include <atomic>
+#include <chrono>
 #include <type_traits>
 #include <mutex>
 #include <condition_variable>
+#include <exception>
+#include <functional>
+#include <thread>
 
+#include <icc/_private/helpers/cache_helpers.hpp>
 #include "icc/_private/containers/exceptions/ContainerError.hpp"
 
 namespace icc {
@@ -23,96 +30,437 @@ namespace _private {
 
 namespace containers {
 
+/**
+ * Policy that is applied when item is pushed in full bounded queue
+ */
+enum class OverflowPolicy {
+  Block,
+  Reject,
+  DropOldest,
+  DropNewest,
+};
+
+/**
+ * Priority of item in queue.
+ * Items with higher priority are popped first
+ */
+enum class Priority {
+  /**
+   * Control items, bounded queue admits them above capacity
+   * and never drops them by overflow policy
+   */
+  High,
+  Normal,
+  Low,
+};
+
+/**
+ * Result of pushing item in queue
+ */
+enum class PushResult {
+  Pushed,
+  DroppedOldest,
+  DroppedNewest,
+  Rejected,
+  NoMemory,
+};
+
 template<typename TItem>
 class ThreadSafeQueue {
  public:
+  /**
+   * Number of priority lanes
+   */
+  static constexpr std::size_t kNumOfLanes = 3;
+  /**
+   * Number of items popped in a row from higher lanes while lower lane
+   * is not empty, after which one item is popped from this lower lane
+   */
+  static constexpr unsigned kStarvationLimit = 64;
+
   ThreadSafeQueue() = default;
 
+  /**
+   * Constructor that warms up pool of nodes
+   * @param _numNodes Number of nodes to preallocate
+   * @param _useThreadCache Whether to use thread local cache of nodes
+   */
+  explicit ThreadSafeQueue(std::size_t _numNodes, bool _useThreadCache = false)
+    : use_thread_cache_{_useThreadCache} {
+    reserve(_numNodes);
+  }
+
+  ThreadSafeQueue(const ThreadSafeQueue &) = delete;
+  ThreadSafeQueue &operator=(const ThreadSafeQueue &) = delete;
+
   ~ThreadSafeQueue() {
-    TItem item;
-    while (tryPop(item));
+    for (auto &lane : lanes_) {
+      while (lane.front_item_ != nullptr) {
+        QueueNode *const kNextNode = lane.front_item_->next_item_;
+        lane.front_item_->item()->~TItem();
+        delete lane.front_item_;
+        lane.front_item_ = kNextNode;
+      }
+    }
+    while (free_nodes_ != nullptr) {
+      QueueNode *const kNextNode = free_nodes_->next_item_;
+      delete free_nodes_;
+      free_nodes_ = kNextNode;
+    }
+    if (use_thread_cache_ && threadCache().owner_id_ == id_) {
+      threadCache().clear();
+    }
   }
 
   template<typename TAddItem>
-  void push(TAddItem &&item) {
-    if (!tryPush(std::forward<TAddItem>(item))) {
+  PushResult push(TAddItem &&item, const Priority _priority = Priority::Normal) {
+    const PushResult kResult = tryPush(std::forward<TAddItem>(item), true, _priority);
+    if (kResult == PushResult::NoMemory) {
       throw std::bad_alloc();
     }
+    return kResult;
   }
 
+  /**
+   * Pushes item in queue taking into account capacity of queue
+   * @param item Item to push
+   * @param _canBlock Whether producer could be blocked in case of OverflowPolicy::Block,
+   * otherwise item is pushed above capacity
+   * @param _priority Priority lane of item
+   * @return Result of pushing, exceptions of waiting, of constructing item
+   *         and of high watermark callback are propagated
+   */
   template<typename TAddItem>
-  bool tryPush(TAddItem &&item) noexcept {
-    auto *itemPtr = new(std::nothrow) TItem(std::forward<TAddItem>(item));
-    if (itemPtr == nullptr) {
-      return false;
+  PushResult tryPush(TAddItem &&item,
+                     const bool _canBlock = true,
+                     const Priority _priority = Priority::Normal) {
+    // NOTE(redra): Declared before the lock, so dropped item is destroyed without holding it
+    DroppedItem droppedItem;
+    QueueNode *addNodePtr = acquireCachedNode();
+    std::unique_lock<std::mutex> lock{mtx_};
+    const PushResult kResult = makeRoom(lock, _canBlock, _priority, droppedItem);
+    if (kResult == PushResult::Rejected ||
+        kResult == PushResult::DroppedNewest) {
+      if (addNodePtr != nullptr) {
+        reclaimNode(lock, addNodePtr);
+      }
+      return kResult;
     }
-    auto *addNodePtr = new(std::nothrow) QueueNode();
     if (addNodePtr == nullptr) {
-      delete itemPtr;
-      return false;
+      addNodePtr = acquireNode(lock);
+      if (addNodePtr == nullptr) {
+        return PushResult::NoMemory;
+      }
     }
-    addNodePtr->item_ptr_ = itemPtr;
-    std::lock_guard<std::mutex> lock{mtx_};
-    if (back_item_ == nullptr) {
-      addNodePtr->next_item_ = back_item_;
-      back_item_ = addNodePtr;
-      front_item_ = addNodePtr;
+    try {
+      new(addNodePtr->item()) TItem(std::forward<TAddItem>(item));
+    } catch (...) {
+      reclaimNode(lock, addNodePtr);
+      throw;
+    }
+    addNodePtr->next_item_ = nullptr;
+    addNodePtr->lane_ = static_cast<std::size_t>(_priority);
+    Lane &lane = lanes_[addNodePtr->lane_];
+    if (lane.back_item_ == nullptr) {
+      lane.back_item_ = addNodePtr;
+      lane.front_item_ = addNodePtr;
     } else {
-      addNodePtr->next_item_ = back_item_->next_item_;
-      back_item_->next_item_ = addNodePtr;
-      back_item_ = addNodePtr;
+      lane.back_item_->next_item_ = addNodePtr;
+      lane.back_item_ = addNodePtr;
     }
-    ++item_count_;
-    cond_var_.notify_all();
-    return true;
+    item_count_.fetch_add(1, std::memory_order_release);
+    if (waiting_consumers_ > 0) {
+      cond_var_.notify_one();
+    }
+    const bool kIsHighWatermark = reachHighWatermark(lock);
+    lock.unlock();
+    if (kIsHighWatermark && on_high_watermark_) {
+      on_high_watermark_();
+    }
+    return kResult;
+  }
+
+  /**
+   * Pushes range of items under single lock with single notification.
+   * Items are moved from the range. In bounded queue items are pushed
+   * one by one, so that overflow policy is applied to each of them.
+   * Pushing stops at the first item for which node could not be allocated,
+   * items before it stay in queue, so nothing is thrown after partial publication.
+   * If moving of item throws, items before it are published and exception is rethrown
+   * @param _first Iterator to the first item
+   * @param _last Iterator past the last item
+   * @param _canBlock Whether producer could be blocked in case of OverflowPolicy::Block
+   * @param _priority Priority lane of items
+   * @return Number of items accepted by queue
+   */
+  template<typename TIterator>
+  std::size_t pushBatch(TIterator _first, TIterator _last,
+                        const bool _canBlock = true,
+                        const Priority _priority = Priority::Normal) {
+    std::size_t numPushed = 0;
+    std::unique_lock<std::mutex> lock{mtx_};
+    if (capacity_ != 0) {
+      lock.unlock();
+      for (; _first != _last; ++_first) {
+        const PushResult kResult = tryPush(std::move(*_first), _canBlock, _priority);
+        if (kResult == PushResult::NoMemory) {
+          break;
+        }
+        if (kResult == PushResult::Pushed ||
+            kResult == PushResult::DroppedOldest) {
+          ++numPushed;
+        }
+      }
+      return numPushed;
+    }
+    Lane batch;
+    std::exception_ptr moveError;
+    for (; _first != _last; ++_first) {
+      QueueNode *const kNodePtr = acquireNode(lock);
+      if (kNodePtr == nullptr) {
+        break;
+      }
+      try {
+        new(kNodePtr->item()) TItem(std::move(*_first));
+      } catch (...) {
+        // NOTE(redra): Items before it are already moved from the range,
+        //  so they are published instead of being destroyed
+        reclaimNode(lock, kNodePtr);
+        moveError = std::current_exception();
+        break;
+      }
+      kNodePtr->next_item_ = nullptr;
+      kNodePtr->lane_ = static_cast<std::size_t>(_priority);
+      if (batch.back_item_ == nullptr) {
+        batch.front_item_ = kNodePtr;
+      } else {
+        batch.back_item_->next_item_ = kNodePtr;
+      }
+      batch.back_item_ = kNodePtr;
+      ++numPushed;
+    }
+    bool isHighWatermark = false;
+    if (numPushed > 0) {
+      Lane &lane = lanes_[static_cast<std::size_t>(_priority)];
+      if (lane.back_item_ == nullptr) {
+        lane.front_item_ = batch.front_item_;
+      } else {
+        lane.back_item_->next_item_ = batch.front_item_;
+      }
+      lane.back_item_ = batch.back_item_;
+      item_count_.fetch_add(static_cast<unsigned>(numPushed), std::memory_order_release);
+      if (waiting_consumers_ > 1 && numPushed > 1) {
+        cond_var_.notify_all();
+      } else if (waiting_consumers_ > 0) {
+        cond_var_.notify_one();
+      }
+      isHighWatermark = reachHighWatermark(lock);
+    }
+    lock.unlock();
+    if (isHighWatermark && on_high_watermark_) {
+      on_high_watermark_();
+    }
+    if (moveError) {
+      std::rethrow_exception(moveError);
+    }
+    return numPushed;
   }
 
   TItem pop() {
-    static_assert(std::is_copy_assignable<TItem>::value,
-                  "TItem is not copy assignable !!");
+    static_assert(std::is_move_assignable<TItem>::value,
+                  "TItem is not move assignable !!");
     TItem item;
     std::unique_lock<std::mutex> lock{mtx_};
     if (!tryPop(lock, item)) {
       throw ContainerError("No items !!");
     }
+    releaseSpace(lock, 1);
     return item;
   }
 
   bool tryPop(TItem &item) {
-    static_assert(std::is_copy_assignable<TItem>::value,
-                  "TItem is not copy assignable !!");
+    static_assert(std::is_move_assignable<TItem>::value,
+                  "TItem is not move assignable !!");
     std::unique_lock<std::mutex> lock{mtx_};
-    QueueNode* nodePtr = nullptr;
-    bool result = tryPop(lock, nodePtr);
-    if (nodePtr) {
-      item = *nodePtr->item_ptr_;
-      lock.unlock();
-      reclaimNode(nodePtr);
+    const bool kResult = tryPop(lock, item);
+    if (kResult) {
+      releaseSpace(lock, 1);
     }
-    return result;
+    return kResult;
   }
 
   TItem waitPop() {
-    static_assert(std::is_copy_assignable<TItem>::value,
-                  "TItem is not copy assignable !!");
+    return waitPop(std::chrono::steady_clock::time_point::max());
+  }
+
+  /**
+   * Waits for item until _until time point
+   * @param _until Time point when waiting is finished
+   * @return Popped item or default constructed item on timeout or interruption
+   */
+  TItem waitPop(const std::chrono::steady_clock::time_point _until) {
+    static_assert(std::is_move_assignable<TItem>::value,
+                  "TItem is not move assignable !!");
+    spinWait();
     std::unique_lock<std::mutex> lock{mtx_};
     TItem item;
-    QueueNode* nodePtr = nullptr;
+    bool isPopped = false;
     while (!interrupted_.load(std::memory_order_acquire) &&
-           !tryPop(lock, nodePtr)) {
-      cond_var_.wait(lock, [this, &lock] {
-        return interrupted_.load(std::memory_order_acquire) ||
-               !empty(lock);
-      });
-    }
-    if (nodePtr) {
-      item = *nodePtr->item_ptr_;
-      lock.unlock();
-      reclaimNode(nodePtr);
+           !(isPopped = tryPop(lock, item))) {
+      if (!parkConsumer(lock, _until)) {
+        break;
+      }
+    }
+    if (isPopped) {
+      releaseSpace(lock, 1);
     }
     return item;
   }
 
+  /**
+   * Waits for items and detaches up to _maxCount of them under single lock.
+   * Detached items are passed to _handler without holding the lock.
+   * If _handler returns false, not handled items are returned back
+   * to the front of queue
+   * @param _handler Callable with signature bool(TItem &&)
+   * @param _maxCount Maximum number of items in batch, 0 means all items
+   * @param _until Time point when waiting for the first item is finished
+   * @return Number of handled items
+   */
+  template<typename THandler>
+  std::size_t waitDrain(THandler &&_handler, const std::size_t _maxCount,
+                        const std::chrono::steady_clock::time_point _until =
+                            std::chrono::steady_clock::time_point::max()) {
+    spinWait();
+    std::unique_lock<std::mutex> lock{mtx_};
+    if (!interrupted_.load(std::memory_order_acquire) && empty(lock)) {
+      parkConsumer(lock, _until);
+    }
+    if (interrupted_.load(std::memory_order_acquire)) {
+      return 0;
+    }
+    DrainedNodes drained{*this};
+    const std::size_t kNumItems = count(lock);
+    const std::size_t kCount = (_maxCount == 0 || kNumItems <= _maxCount)
+                               ? kNumItems : _maxCount;
+    for (std::size_t i = 0; i < kCount; ++i) {
+      QueueNode *const kNodePtr = detachNext(lock);
+      if (drained.last_ == nullptr) {
+        drained.first_ = kNodePtr;
+      } else {
+        drained.last_->next_item_ = kNodePtr;
+      }
+      drained.last_ = kNodePtr;
+    }
+    drained.count_ = kCount;
+    releaseSpace(lock, drained.count_);
+
+    std::size_t handledCount = 0;
+    while (drained.first_ != nullptr) {
+      QueueNode *const kNodePtr = drained.first_;
+      drained.first_ = kNodePtr->next_item_;
+      --drained.count_;
+      TItem item = std::move(*kNodePtr->item());
+      kNodePtr->item()->~TItem();
+      kNodePtr->next_item_ = drained.handled_;
+      drained.handled_ = kNodePtr;
+      ++handledCount;
+      if (!_handler(std::move(item))) {
+        break;
+      }
+    }
+    return handledCount;
+  }
+
+  /**
+   * Preallocates nodes, so that following pushes do not allocate memory
+   * @param _numNodes Number of nodes to add in pool of free nodes
+   */
+  void reserve(std::size_t _numNodes) {
+    QueueNode *firstNode = nullptr;
+    QueueNode *lastNode = nullptr;
+    for (std::size_t i = 0; i < _numNodes; ++i) {
+      auto *nodePtr = new QueueNode();
+      nodePtr->next_item_ = firstNode;
+      firstNode = nodePtr;
+      if (lastNode == nullptr) {
+        lastNode = nodePtr;
+      }
+    }
+    if (firstNode != nullptr) {
+      std::lock_guard<std::mutex> lock{mtx_};
+      lastNode->next_item_ = free_nodes_;
+      free_nodes_ = firstNode;
+      allocation_count_ += _numNodes;
+    }
+  }
+
+  /**
+   * Number of nodes that were allocated by this queue
+   * @return Number of allocations
+   */
+  std::size_t allocations() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return allocation_count_;
+  }
+
+  /**
+   * Limits number of items in queue
+   * @param _capacity Maximum number of items, 0 means unbounded queue
+   * @param _policy Policy applied when item is pushed in full queue
+   */
+  void setCapacity(std::size_t _capacity, OverflowPolicy _policy = OverflowPolicy::Block) {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      capacity_ = _capacity;
+      overflow_policy_ = _policy;
+    }
+    not_full_cond_var_.notify_all();
+  }
+
+  std::size_t capacity() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return capacity_;
+  }
+
+  /**
+   * Sets watermarks of queue depth.
+   * _onHigh is called once queue depth reaches _high,
+   * _onLow is called once queue depth falls back to _low.
+   * Callbacks are called without holding the lock of queue.
+   * Should be set before queue is used
+   * @param _high High watermark, 0 disables watermarks
+   * @param _low Low watermark
+   * @param _onHigh Callback for high watermark
+   * @param _onLow Callback for low watermark
+   */
+  void setWatermarks(std::size_t _high, std::size_t _low,
+                     std::function<void(void)> _onHigh,
+                     std::function<void(void)> _onLow) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    high_watermark_ = _high;
+    low_watermark_ = _low;
+    is_high_watermark_ = false;
+    on_high_watermark_ = std::move(_onHigh);
+    on_low_watermark_ = std::move(_onLow);
+  }
+
+  /**
+   * Sets number of iterations that consumer busy waits for new item
+   * before parking on condition variable.
+   * First half of iterations are spent on processor pause,
+   * second half on yielding of thread. Spinning is disabled on single processor
+   * @param _spinCount Number of iterations, 0 disables spinning
+   */
+  void setSpinCount(unsigned _spinCount) {
+    if (std::thread::hardware_concurrency() == 1) {
+      // NOTE(redra): On single processor producer could not make progress
+      //  while consumer is spinning, so spinning only adds latency
+      _spinCount = 0;
+    }
+    spin_count_.store(_spinCount, std::memory_order_relaxed);
+  }
+
   bool isInterrupt() const {
     return interrupted_.load(std::memory_order_acquire);
   }
@@ -123,6 +471,7 @@ class ThreadSafeQueue {
       interrupted_.store(true, std::memory_order_release);
     }
     cond_var_.notify_all();
+    not_full_cond_var_.notify_all();
   }
 
   void reset() {
@@ -130,61 +479,427 @@ class ThreadSafeQueue {
   }
 
   bool empty() const {
-    std::lock_guard<std::mutex> lock{mtx_};
+    std::unique_lock<std::mutex> lock{mtx_};
     return empty(lock);
   }
 
   unsigned count() const {
-    std::lock_guard<std::mutex> lock{mtx_};
+    std::unique_lock<std::mutex> lock{mtx_};
     return count(lock);
   }
 
  private:
+  /**
+   * Node with inline storage for item.
+   * Item is constructed in storage_ only while node is in queue
+   */
   struct QueueNode {
-    TItem *item_ptr_ = nullptr;
+    typename std::aligned_storage<sizeof(TItem), alignof(TItem)>::type storage_;
     QueueNode *next_item_ = nullptr;
+    std::size_t lane_ = 0;
+
+    TItem * item() {
+      return reinterpret_cast<TItem *>(&storage_);
+    }
+  };
+
+  /**
+   * Per thread cache of free nodes.
+   * Allows to take node for push without locking of queue.
+   * Cache holds nodes of one queue at a time, so nodes do not move
+   * between queues and allocations() of each queue stays exact
+   */
+  struct NodeCache {
+    static constexpr unsigned kMaxSize = 64;
+
+    ~NodeCache() {
+      clear();
+    }
+
+    void clear() {
+      while (nodes_ != nullptr) {
+        QueueNode *const kNextNode = nodes_->next_item_;
+        delete nodes_;
+        nodes_ = kNextNode;
+      }
+      size_ = 0;
+    }
+
+    std::uint64_t owner_id_ = 0;
+    QueueNode *nodes_ = nullptr;
+    unsigned size_ = 0;
+  };
+
+  /**
+   * Storage for item dropped by OverflowPolicy::DropOldest.
+   * Item is constructed only if it is dropped, so TItem does not need
+   * to be default constructible
+   */
+  class DroppedItem {
+   public:
+    DroppedItem() = default;
+    DroppedItem(const DroppedItem &) = delete;
+    DroppedItem & operator=(const DroppedItem &) = delete;
+
+    ~DroppedItem() {
+      if (item_ != nullptr) {
+        item_->~TItem();
+      }
+    }
+
+    void store(TItem &&_item) {
+      item_ = new(&storage_) TItem(std::move(_item));
+    }
+
+   private:
+    typename std::aligned_storage<sizeof(TItem), alignof(TItem)>::type storage_;
+    TItem *item_ = nullptr;
+  };
+
+  /**
+   * List of items with the same priority
+   */
+  struct Lane {
+    QueueNode *front_item_ = nullptr;
+    QueueNode *back_item_ = nullptr;
   };
 
+  /**
+   * Nodes detached by waitDrain. On destruction handled nodes are
+   * recycled and not handled items are returned to the front of their lanes
+   */
+  struct DrainedNodes {
+    explicit DrainedNodes(ThreadSafeQueue &_queue)
+      : queue_(_queue) {
+    }
+
+    ~DrainedNodes() {
+      std::lock_guard<std::mutex> lock{queue_.mtx_};
+      while (handled_ != nullptr) {
+        QueueNode *const kNextNode = handled_->next_item_;
+        handled_->next_item_ = queue_.free_nodes_;
+        queue_.free_nodes_ = handled_;
+        handled_ = kNextNode;
+      }
+      Lane notHandled[kNumOfLanes];
+      while (first_ != nullptr) {
+        QueueNode *const kNextNode = first_->next_item_;
+        Lane &lane = notHandled[first_->lane_];
+        first_->next_item_ = nullptr;
+        if (lane.back_item_ == nullptr) {
+          lane.front_item_ = first_;
+        } else {
+          lane.back_item_->next_item_ = first_;
+        }
+        lane.back_item_ = first_;
+        first_ = kNextNode;
+      }
+      for (std::size_t i = 0; i < kNumOfLanes; ++i) {
+        if (notHandled[i].front_item_ != nullptr) {
+          Lane &lane = queue_.lanes_[i];
+          notHandled[i].back_item_->next_item_ = lane.front_item_;
+          lane.front_item_ = notHandled[i].front_item_;
+          if (lane.back_item_ == nullptr) {
+            lane.back_item_ = notHandled[i].back_item_;
+          }
+        }
+      }
+      queue_.item_count_.fetch_add(static_cast<unsigned>(count_), std::memory_order_release);
+      if (queue_.waiting_consumers_ > 0) {
+        queue_.cond_var_.notify_all();
+      }
+    }
+
+    ThreadSafeQueue &queue_;
+    QueueNode *first_ = nullptr;
+    QueueNode *last_ = nullptr;
+    QueueNode *handled_ = nullptr;
+    std::size_t count_ = 0;
+  };
+
+  static NodeCache & threadCache() {
+    static thread_local NodeCache cache;
+    return cache;
+  }
+
+  static std::uint64_t nextQueueId() {
+    static std::atomic<std::uint64_t> lastQueueId{0};
+    return lastQueueId.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
   bool empty(const std::unique_lock<std::mutex> &lock) const {
-    return item_count_ == 0;
+    return item_count_.load(std::memory_order_relaxed) == 0;
   }
 
   unsigned count(const std::unique_lock<std::mutex> &lock) const {
-    return item_count_;
+    return item_count_.load(std::memory_order_relaxed);
   }
 
-  bool tryPop(const std::unique_lock<std::mutex> &lock, QueueNode *& nodePtr) {
-    if (front_item_ == nullptr) {
-      return false;
+  QueueNode * acquireCachedNode() {
+    if (!use_thread_cache_) {
+      return nullptr;
+    }
+    NodeCache &cache = threadCache();
+    if (cache.owner_id_ != id_) {
+      return nullptr;
+    }
+    QueueNode *const kNodePtr = cache.nodes_;
+    if (kNodePtr != nullptr) {
+      cache.nodes_ = kNodePtr->next_item_;
+      --cache.size_;
+    }
+    return kNodePtr;
+  }
+
+  QueueNode * acquireNode(const std::unique_lock<std::mutex> &lock) {
+    QueueNode *nodePtr = free_nodes_;
+    if (nodePtr != nullptr) {
+      free_nodes_ = nodePtr->next_item_;
     } else {
-      QueueNode *const kPrevFrontNode = front_item_;
-      TItem *const kItemPtr = front_item_->item_ptr_;
-      if (kPrevFrontNode == back_item_) {
-        front_item_ = nullptr;
-        back_item_ = nullptr;
-      } else {
-        QueueNode *const kNextFrontNode = front_item_->next_item_;
-        front_item_ = kNextFrontNode;
+      nodePtr = new(std::nothrow) QueueNode();
+      if (nodePtr != nullptr) {
+        ++allocation_count_;
       }
-      nodePtr = kPrevFrontNode;
-      --item_count_;
+    }
+    return nodePtr;
+  }
+
+  void reclaimNode(const std::unique_lock<std::mutex> &lock, QueueNode *nodePtr) {
+    if (use_thread_cache_) {
+      NodeCache &cache = threadCache();
+      if (cache.owner_id_ != id_) {
+        // NOTE(redra): Nodes of other queue could not be returned to it
+        //  without its lock and it could be already destroyed
+        cache.clear();
+        cache.owner_id_ = id_;
+      }
+      if (cache.size_ < NodeCache::kMaxSize) {
+        nodePtr->next_item_ = cache.nodes_;
+        cache.nodes_ = nodePtr;
+        ++cache.size_;
+        return;
+      }
+    }
+    nodePtr->next_item_ = free_nodes_;
+    free_nodes_ = nodePtr;
+  }
+
+  /**
+   * Applies overflow policy if queue is full
+   * @param lock Lock of queue
+   * @param _canBlock Whether producer could wait for free space
+   * @param _priority Priority lane of new item
+   * @param droppedItem Storage for item dropped from front of queue by OverflowPolicy::DropOldest
+   * @return Result of pushing for new item
+   */
+  PushResult makeRoom(std::unique_lock<std::mutex> &lock,
+                      const bool _canBlock,
+                      const Priority _priority,
+                      DroppedItem &droppedItem) {
+    if (capacity_ == 0 || count(lock) < capacity_ ||
+        Priority::High == _priority) {
+      return PushResult::Pushed;
+    }
+    switch (overflow_policy_) {
+      case OverflowPolicy::Block: {
+        if (!_canBlock) {
+          // NOTE(redra): Producer that is consumer at the same time
+          //  would wait forever, so item is pushed above capacity
+          return PushResult::Pushed;
+        }
+        ++blocked_producers_;
+        not_full_cond_var_.wait(lock, [this, &lock] {
+          return interrupted_.load(std::memory_order_acquire) ||
+                 capacity_ == 0 || count(lock) < capacity_;
+        });
+        --blocked_producers_;
+        if (capacity_ != 0 && count(lock) >= capacity_) {
+          return PushResult::Rejected;
+        }
+        return PushResult::Pushed;
+      }
+      case OverflowPolicy::Reject:
+        return PushResult::Rejected;
+      case OverflowPolicy::DropOldest: {
+        // NOTE(redra): Oldest item of the lowest priority is dropped, but never
+        //  item of higher lane than new one and never control item of High lane
+        const std::size_t kNewLaneIdx = static_cast<std::size_t>(_priority);
+        std::size_t laneIdx = kNumOfLanes;
+        while (--laneIdx >= kNewLaneIdx && lanes_[laneIdx].front_item_ == nullptr);
+        if (laneIdx < kNewLaneIdx) {
+          return PushResult::DroppedNewest;
+        }
+        QueueNode *const kNodePtr = detachFront(lock, laneIdx);
+        droppedItem.store(std::move(*kNodePtr->item()));
+        kNodePtr->item()->~TItem();
+        reclaimNode(lock, kNodePtr);
+        return PushResult::DroppedOldest;
+      }
+      case OverflowPolicy::DropNewest:
+        return PushResult::DroppedNewest;
+    }
+    return PushResult::Rejected;
+  }
+
+  bool reachHighWatermark(const std::unique_lock<std::mutex> &lock) {
+    if (high_watermark_ != 0 && !is_high_watermark_ &&
+        count(lock) >= high_watermark_) {
+      is_high_watermark_ = true;
       return true;
     }
+    return false;
+  }
+
+  /**
+   * Wakes up blocked producers after items were removed from queue,
+   * releases the lock and calls low watermark callback if needed
+   * @param lock Lock of queue
+   * @param _numItems Number of removed items
+   */
+  void releaseSpace(std::unique_lock<std::mutex> &lock, const std::size_t _numItems) {
+    const bool kHasBlockedProducers = blocked_producers_ > 0;
+    bool isLowWatermark = false;
+    if (is_high_watermark_ && count(lock) <= low_watermark_) {
+      is_high_watermark_ = false;
+      isLowWatermark = true;
+    }
+    lock.unlock();
+    if (kHasBlockedProducers) {
+      if (_numItems == 1) {
+        not_full_cond_var_.notify_one();
+      } else {
+        not_full_cond_var_.notify_all();
+      }
+    }
+    if (isLowWatermark && on_low_watermark_) {
+      on_low_watermark_();
+    }
+  }
+
+  /**
+   * Busy waits for new item during spin_count_ iterations
+   */
+  void spinWait() const {
+    const unsigned kSpinCount = spin_count_.load(std::memory_order_relaxed);
+    for (unsigned i = 0; i < kSpinCount; ++i) {
+      if (interrupted_.load(std::memory_order_acquire) ||
+          item_count_.load(std::memory_order_acquire) != 0) {
+        return;
+      }
+      if (i < kSpinCount / 2) {
+        icc::helpers::cpuRelax();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /**
+   * Parks consumer until item is pushed, queue is interrupted or _until is reached.
+   * Producers notify condition variable only if there are parked consumers
+   * @param lock Lock of queue
+   * @param _until Time point when waiting is finished
+   * @return false on timeout
+   */
+  bool parkConsumer(std::unique_lock<std::mutex> &lock,
+                    const std::chrono::steady_clock::time_point _until) {
+    auto isReady = [this, &lock] {
+      return interrupted_.load(std::memory_order_acquire) ||
+             !empty(lock);
+    };
+    ++waiting_consumers_;
+    bool isWokenUp = true;
+    if (_until == std::chrono::steady_clock::time_point::max()) {
+      cond_var_.wait(lock, isReady);
+    } else {
+      isWokenUp = cond_var_.wait_until(lock, _until, isReady);
+    }
+    --waiting_consumers_;
+    return isWokenUp;
+  }
+
+  QueueNode * detachFront(const std::unique_lock<std::mutex> &lock, const std::size_t _laneIdx) {
+    Lane &lane = lanes_[_laneIdx];
+    QueueNode *const kNodePtr = lane.front_item_;
+    lane.front_item_ = kNodePtr->next_item_;
+    if (lane.front_item_ == nullptr) {
+      lane.back_item_ = nullptr;
+    }
+    kNodePtr->next_item_ = nullptr;
+    item_count_.fetch_sub(1, std::memory_order_relaxed);
+    return kNodePtr;
   }
 
-  void reclaimNode(const QueueNode *nodePtr) const {
-    TItem* itemPtr = nodePtr->item_ptr_;
-    delete nodePtr;
-    delete itemPtr;
+  /**
+   * Detaches node from the highest not empty lane.
+   * Each lower not empty lane counts items popped while it was passed over,
+   * once it reaches kStarvationLimit one item is taken from this lane,
+   * so every lane makes progress, not only the lowest one
+   * @param lock Lock of queue
+   * @return Detached node or nullptr if queue is empty
+   */
+  QueueNode * detachNext(const std::unique_lock<std::mutex> &lock) {
+    std::size_t laneIdx = kNumOfLanes;
+    std::size_t starvedLaneIdx = kNumOfLanes;
+    for (std::size_t i = 0; i < kNumOfLanes; ++i) {
+      if (lanes_[i].front_item_ == nullptr) {
+        starved_pops_[i] = 0;
+      } else if (laneIdx == kNumOfLanes) {
+        laneIdx = i;
+      } else if (starvedLaneIdx == kNumOfLanes &&
+                 starved_pops_[i] >= kStarvationLimit) {
+        starvedLaneIdx = i;
+      }
+    }
+    if (laneIdx == kNumOfLanes) {
+      return nullptr;
+    }
+    if (starvedLaneIdx != kNumOfLanes) {
+      laneIdx = starvedLaneIdx;
+    }
+    for (std::size_t i = 0; i < kNumOfLanes; ++i) {
+      if (i != laneIdx && lanes_[i].front_item_ != nullptr) {
+        ++starved_pops_[i];
+      }
+    }
+    starved_pops_[laneIdx] = 0;
+    return detachFront(lock, laneIdx);
+  }
+
+  bool tryPop(const std::unique_lock<std::mutex> &lock, TItem &item) {
+    QueueNode *const kNodePtr = detachNext(lock);
+    if (kNodePtr == nullptr) {
+      return false;
+    }
+    TItem *const kItemPtr = kNodePtr->item();
+    item = std::move(*kItemPtr);
+    kItemPtr->~TItem();
+    reclaimNode(lock, kNodePtr);
+    return true;
   }
 
   std::condition_variable cond_var_;
+  std::condition_variable not_full_cond_var_;
   mutable std::mutex mtx_;
 
   std::atomic<bool> interrupted_{false};
-  unsigned item_count_ = 0;
-  QueueNode *front_item_ = nullptr;
-  QueueNode *back_item_ = nullptr;
+  const std::uint64_t id_ = nextQueueId();
+  const bool use_thread_cache_ = false;
+  std::atomic<unsigned> item_count_{0};
+  std::atomic<unsigned> spin_count_{0};
+  unsigned waiting_consumers_ = 0;
+  std::size_t allocation_count_ = 0;
+  Lane lanes_[kNumOfLanes];
+  unsigned starved_pops_[kNumOfLanes] = {};
+  QueueNode *free_nodes_ = nullptr;
+  std::size_t capacity_ = 0;
+  OverflowPolicy overflow_policy_ = OverflowPolicy::Block;
+  unsigned blocked_producers_ = 0;
+  std::size_t high_watermark_ = 0;
+  std::size_t low_watermark_ = 0;
+  bool is_high_watermark_ = false;
+  std::function<void(void)> on_high_watermark_;
+  std::function<void(void)> on_low_watermark_;
 };
 
 }
@@ -0,0 +1,205 @@
+/**
+ * @file TimerQueue.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains queue of delayed and periodic items that is checked
+ * by run loop of context instead of OS timers
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_TIMER_QUEUE_HPP
+#define ICC_TIMER_QUEUE_HPP
+
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace icc {
+
+namespace _private {
+
+namespace containers {
+
+using TimerClock = std::chrono::steady_clock;
+
+/**
+ * What periodic timer does with periods missed because of late handling
+ */
+enum class OverrunPolicy {
+  /**
+   * Missed periods are skipped, timer keeps its phase
+   */
+  Skip,
+  /**
+   * Timer is handled once for each missed period back-to-back
+   */
+  CatchUp,
+};
+
+/**
+ * Cheap handle of pending timer.
+ * Cancelled timer is removed lazily when its time point is reached
+ */
+class TimerHandle {
+ public:
+  TimerHandle() = default;
+
+  /**
+   * Creates handle of new timer
+   */
+  static TimerHandle create() {
+    return TimerHandle{std::make_shared<std::atomic<bool>>(false)};
+  }
+
+  /**
+   * Cancels timer, could be called from any thread.
+   * Periodic timer is not executed anymore after cancellation
+   */
+  void cancel() const {
+    if (cancelled_) {
+      cancelled_->store(true, std::memory_order_release);
+    }
+  }
+
+  bool isCancelled() const {
+    return !cancelled_ || cancelled_->load(std::memory_order_acquire);
+  }
+
+  explicit operator bool() const {
+    return static_cast<bool>(cancelled_);
+  }
+
+ private:
+  explicit TimerHandle(std::shared_ptr<std::atomic<bool>> _cancelled)
+    : cancelled_{std::move(_cancelled)} {
+  }
+
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+/**
+ * Binary heap of timers ordered by time point.
+ * It is not thread safe and is used only from thread of its owner
+ */
+template<typename TItem>
+class TimerQueue {
+ public:
+  TimerQueue() = default;
+  TimerQueue(const TimerQueue &) = delete;
+  TimerQueue &operator=(const TimerQueue &) = delete;
+
+  /**
+   * Adds timer
+   * @param item Item of timer
+   * @param _timePoint Time point when item should be handled
+   * @param _period Period of timer, zero duration means single shot timer
+   * @param _handle Handle used to cancel timer
+   * @param _policy Policy for periods missed by periodic timer
+   */
+  template<typename TAddItem>
+  void push(TAddItem &&item,
+            const TimerClock::time_point _timePoint,
+            const TimerClock::duration _period,
+            TimerHandle _handle,
+            const OverrunPolicy _policy = OverrunPolicy::Skip) {
+    entries_.push_back(Entry{_timePoint, next_sequence_++, _period, _policy,
+                             TItem(std::forward<TAddItem>(item)), std::move(_handle)});
+    std::push_heap(entries_.begin(), entries_.end(), LaterEntry{});
+  }
+
+  /**
+   * Time point of the earliest not cancelled timer
+   * @return Time point, TimerClock::time_point::max() if there is no timers
+   */
+  TimerClock::time_point nextTimePoint() {
+    while (!entries_.empty() && entries_.front().handle_.isCancelled()) {
+      popFront();
+    }
+    return entries_.empty() ? TimerClock::time_point::max()
+                            : entries_.front().time_point_;
+  }
+
+  /**
+   * Passes items of expired timers to _handler in order of time points.
+   * Periodic timer is rearmed after _handler relative to its previous
+   * time point, so it does not drift. Missed periods are handled according
+   * to OverrunPolicy of timer
+   * @param _now Current time point
+   * @param _handler Callable with signature void(TItem &)
+   * @return Number of handled items
+   */
+  template<typename THandler>
+  std::size_t handleExpired(const TimerClock::time_point _now, THandler &&_handler) {
+    std::size_t handledCount = 0;
+    while (!entries_.empty() && entries_.front().time_point_ <= _now) {
+      Entry entry = popFront();
+      if (entry.handle_.isCancelled()) {
+        continue;
+      }
+      _handler(entry.item_);
+      ++handledCount;
+      if (entry.period_ > TimerClock::duration::zero() &&
+          !entry.handle_.isCancelled()) {
+        TimerClock::time_point nextTimePoint = entry.time_point_ + entry.period_;
+        if (nextTimePoint <= _now && OverrunPolicy::Skip == entry.policy_) {
+          nextTimePoint += ((_now - nextTimePoint) / entry.period_ + 1) * entry.period_;
+        }
+        push(std::move(entry.item_), nextTimePoint, entry.period_,
+             std::move(entry.handle_), entry.policy_);
+      }
+    }
+    return handledCount;
+  }
+
+  bool empty() const {
+    return entries_.empty();
+  }
+
+  std::size_t count() const {
+    return entries_.size();
+  }
+
+ private:
+  struct Entry {
+    TimerClock::time_point time_point_;
+    std::uint64_t sequence_;
+    TimerClock::duration period_;
+    OverrunPolicy policy_;
+    TItem item_;
+    TimerHandle handle_;
+  };
+
+  /**
+   * Comparator that makes std heap functions keep the earliest entry on top
+   */
+  struct LaterEntry {
+    bool operator()(const Entry &_lhs, const Entry &_rhs) const {
+      if (_lhs.time_point_ != _rhs.time_point_) {
+        return _lhs.time_point_ > _rhs.time_point_;
+      }
+      return _lhs.sequence_ > _rhs.sequence_;
+    }
+  };
+
+  Entry popFront() {
+    std::pop_heap(entries_.begin(), entries_.end(), LaterEntry{});
+    Entry entry = std::move(entries_.back());
+    entries_.pop_back();
+    return entry;
+  }
+
+  std::uint64_t next_sequence_ = 0;
+  std::vector<Entry> entries_;
+};
+
+}
+
+}
+
+}
+
+#endif //ICC_TIMER_QUEUE_HPP
@@ -0,0 +1,169 @@
+/**
+ * @file WorkStealingDeque.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains lock-free Chase-Lev deque of pointers.
+ * Owner thread pushes and pops items in LIFO order on bottom,
+ * other threads steal items in FIFO order from top
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_WORK_STEALING_DEQUE_HPP
+#define ICC_WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <icc/_private/helpers/cache_helpers.hpp>
+
+namespace icc {
+
+namespace _private {
+
+namespace containers {
+
+/**
+ * Implementation follows "Correct and Efficient Work-Stealing for
+ * Weak Memory Models" by N.M. Le, A. Pop, A. Cohen and F.Z. Nardelli.
+ * push() and pop() could be called only from owner thread,
+ * steal() and empty() from any thread.
+ * Deque does not own items, it stores only pointers to them
+ */
+template<typename TItem>
+class WorkStealingDeque {
+ public:
+  static constexpr std::int64_t kDefaultCapacity = 256;
+
+  /**
+   * Constructor of deque
+   * @param _capacity Initial capacity, it is rounded up to power of two
+   */
+  explicit WorkStealingDeque(const std::int64_t _capacity = kDefaultCapacity)
+    : buffer_{new Buffer(roundUpToPowerOfTwo(_capacity))} {
+    buffers_.emplace_back(buffer_.load(std::memory_order_relaxed));
+  }
+
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+  void push(TItem *_item) {
+    const std::int64_t kBottom = bottom_.load(std::memory_order_relaxed);
+    const std::int64_t kTop = top_.load(std::memory_order_acquire);
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    if (kBottom - kTop > buffer->capacity_ - 1) {
+      buffer = grow(buffer, kBottom, kTop);
+    }
+    buffer->put(kBottom, _item);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(kBottom + 1, std::memory_order_relaxed);
+  }
+
+  TItem * pop() {
+    const std::int64_t kBottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer *const kBuffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(kBottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    TItem *item = nullptr;
+    if (top <= kBottom) {
+      item = kBuffer->get(kBottom);
+      if (top == kBottom) {
+        // NOTE(redra): The last item, race with thieves
+        if (!top_.compare_exchange_strong(top, top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+          item = nullptr;
+        }
+        bottom_.store(kBottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(kBottom + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  TItem * steal() {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t kBottom = bottom_.load(std::memory_order_acquire);
+    if (top < kBottom) {
+      Buffer *const kBuffer = buffer_.load(std::memory_order_acquire);
+      TItem *const kItem = kBuffer->get(top);
+      if (top_.compare_exchange_strong(top, top + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return kItem;
+      }
+    }
+    return nullptr;
+  }
+
+  bool empty() const {
+    const std::int64_t kTop = top_.load(std::memory_order_acquire);
+    const std::int64_t kBottom = bottom_.load(std::memory_order_acquire);
+    return kBottom <= kTop;
+  }
+
+ private:
+  /**
+   * Index of slot is masked by capacity - 1, so capacity should be power of two
+   */
+  static std::int64_t roundUpToPowerOfTwo(const std::int64_t _capacity) {
+    std::int64_t capacity = 1;
+    while (capacity < _capacity) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  struct Buffer {
+    explicit Buffer(const std::int64_t _capacity)
+      : capacity_{_capacity}
+      , mask_{_capacity - 1}
+      , slots_{new std::atomic<TItem *>[static_cast<std::size_t>(_capacity)]} {
+    }
+
+    TItem * get(const std::int64_t _index) const {
+      return slots_[_index & mask_].load(std::memory_order_relaxed);
+    }
+
+    void put(const std::int64_t _index, TItem *_item) {
+      slots_[_index & mask_].store(_item, std::memory_order_relaxed);
+    }
+
+    const std::int64_t capacity_;
+    const std::int64_t mask_;
+    std::unique_ptr<std::atomic<TItem *>[]> slots_;
+  };
+
+  /**
+   * Doubles capacity of buffer. Old buffers are kept until destruction of
+   * deque, because thieves could still read from them
+   */
+  Buffer * grow(Buffer *_buffer, const std::int64_t _bottom, const std::int64_t _top) {
+    Buffer *const kNewBuffer = new Buffer(_buffer->capacity_ * 2);
+    buffers_.emplace_back(kNewBuffer);
+    for (std::int64_t i = _top; i < _bottom; ++i) {
+      kNewBuffer->put(i, _buffer->get(i));
+    }
+    buffer_.store(kNewBuffer, std::memory_order_release);
+    return kNewBuffer;
+  }
+
+  std::atomic<std::int64_t> top_{0};
+  char top_padding_[icc::helpers::kCacheLineSize - sizeof(std::atomic<std::int64_t>)];
+  std::atomic<std::int64_t> bottom_{0};
+  char bottom_padding_[icc::helpers::kCacheLineSize - sizeof(std::atomic<std::int64_t>)];
+  std::atomic<Buffer *> buffer_;
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}
+
+}
+
+}
+
+#endif //ICC_WORK_STEALING_DEQUE_HPP
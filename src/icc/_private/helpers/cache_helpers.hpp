@@ -0,0 +1,43 @@
+/**
+ * @file cache_helpers.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains helper constants for avoiding false sharing between threads
+ * and helpers for busy waiting
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_CACHE_HELPERS_HPP
+#define ICC_CACHE_HELPERS_HPP
+
+#include <cstddef>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace icc {
+
+namespace helpers {
+
+/**
+ * Size of cache line that is used for padding of data
+ * that is written concurrently from different threads
+ */
+constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * Hints processor that thread is busy waiting
+ */
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+}
+
+}
+
+#endif //ICC_CACHE_HELPERS_HPP
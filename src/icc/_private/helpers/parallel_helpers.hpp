@@ -0,0 +1,145 @@
+/**
+ * @file parallel_helpers.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains ChunkedLoop that splits range on chunks and executes them
+ * on ThreadPool. Calling thread takes chunks as well instead of blocking,
+ * so nested parallel loops called from thread of pool do not dead lock
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_PARALLEL_HELPERS_HPP
+#define ICC_PARALLEL_HELPERS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace icc {
+
+namespace helpers {
+
+class ChunkedLoop {
+ public:
+  using ChunkFunction = std::function<void(std::size_t _begin, std::size_t _end, std::size_t _chunkIdx)>;
+
+  /**
+   * Number of chunks per participating thread used by automatic grain,
+   * several chunks per thread smooth out imbalance between chunks
+   */
+  static constexpr std::size_t kChunksPerThread = 8;
+
+  /**
+   * Grain size used when caller does not provide it
+   * @param _size Size of range
+   * @param _numThreads Number of participating threads
+   * @return Number of items in one chunk
+   */
+  static std::size_t autoGrain(const std::size_t _size, const std::size_t _numThreads) {
+    const std::size_t kNumChunks = _numThreads * kChunksPerThread;
+    return std::max<std::size_t>(1, (_size + kNumChunks - 1) / kNumChunks);
+  }
+
+  /**
+   * Executes _function for chunks of range [0, _size) on _pool and calling thread.
+   * Returns when all chunks are executed, rethrows the first exception of chunks.
+   * If helper could not be pushed in _pool, its chunks are executed by calling thread
+   * @param _pool ThreadPool used for helper tasks
+   * @param _size Size of range
+   * @param _grain Number of items in one chunk, 0 means automatic grain
+   * @param _function Function called for each chunk
+   */
+  template <typename TPool>
+  static void run(TPool &_pool, const std::size_t _size, const std::size_t _grain,
+                  ChunkFunction _function) {
+    if (_size == 0) {
+      return;
+    }
+    const std::size_t kNumThreads = _pool.size() + 1;
+    const std::size_t kGrain = _grain != 0 ? _grain : autoGrain(_size, kNumThreads);
+    auto loop = std::make_shared<ChunkedLoop>(_size, kGrain, std::move(_function));
+    const std::size_t kNumHelpers = std::min(kNumThreads - 1, loop->num_chunks_ - 1);
+    try {
+      for (std::size_t i = 0; i < kNumHelpers; ++i) {
+        _pool.push([loop] {
+          loop->execute();
+        });
+      }
+    } catch (...) {
+      // NOTE(redra): Helpers are only an optimization, chunks that are not
+      //  taken by already pushed helpers are executed by calling thread below
+    }
+    loop->execute();
+    loop->wait();
+  }
+
+  ChunkedLoop(const std::size_t _size, const std::size_t _grain, ChunkFunction _function)
+    : size_{_size}
+    , grain_{_grain}
+    , num_chunks_{(_size + _grain - 1) / _grain}
+    , function_{std::move(_function)} {
+  }
+
+ private:
+  /**
+   * Takes chunks until all of them are taken.
+   * Helper that starts after loop is finished does not touch function
+   */
+  void execute() {
+    for (;;) {
+      const std::size_t kChunkIdx = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (kChunkIdx >= num_chunks_) {
+        return;
+      }
+      if (!is_failed_.load(std::memory_order_relaxed)) {
+        const std::size_t kBegin = kChunkIdx * grain_;
+        const std::size_t kEnd = std::min(size_, kBegin + grain_);
+        try {
+          function_(kBegin, kEnd, kChunkIdx);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock{mtx_};
+          if (!exception_) {
+            exception_ = std::current_exception();
+          }
+          is_failed_.store(true, std::memory_order_relaxed);
+        }
+      }
+      if (completed_chunks_.fetch_add(1, std::memory_order_acq_rel) + 1 == num_chunks_) {
+        std::lock_guard<std::mutex> lock{mtx_};
+        cond_var_.notify_all();
+      }
+    }
+  }
+
+  void wait() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    cond_var_.wait(lock, [this] {
+      return completed_chunks_.load(std::memory_order_acquire) == num_chunks_;
+    });
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+  const std::size_t size_;
+  const std::size_t grain_;
+  const std::size_t num_chunks_;
+  ChunkFunction function_;
+  std::atomic<std::size_t> next_chunk_{0};
+  std::atomic<std::size_t> completed_chunks_{0};
+  std::atomic<bool> is_failed_{false};
+  std::exception_ptr exception_;
+  std::mutex mtx_;
+  std::condition_variable cond_var_;
+};
+
+}
+
+}
+
+#endif //ICC_PARALLEL_HELPERS_HPP
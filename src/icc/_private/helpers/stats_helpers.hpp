@@ -0,0 +1,212 @@
+/**
+ * @file stats_helpers.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains StatsRecorder that collects ContextStats with relaxed atomics.
+ * Collecting is switched on in runtime by StatsRecorder::enable() and
+ * could be compiled out by defining ICC_DISABLE_CONTEXT_STATS.
+ * Contains StampedAction that keeps time of push in queue node next to Action
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_STATS_HELPERS_HPP
+#define ICC_STATS_HELPERS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+#include <icc/Action.hpp>
+#include <icc/ContextStats.hpp>
+
+namespace icc {
+
+namespace helpers {
+
+/**
+ * Action stored in queue node together with time of its push.
+ * Time is kept next to Action instead of wrapping Action into another
+ * Action, so stamping does not allocate memory
+ */
+struct StampedAction {
+  using Clock = std::chrono::steady_clock;
+
+  StampedAction() = default;
+
+  StampedAction(Action _action, const Clock::time_point _pushTime = Clock::time_point())
+    : action_(std::move(_action))
+    , push_time_(_pushTime) {
+  }
+
+  bool isStamped() const {
+    return push_time_ != Clock::time_point();
+  }
+
+  Action action_;
+  Clock::time_point push_time_;
+};
+
+class StatsRecorder {
+ public:
+  using Clock = StampedAction::Clock;
+
+  bool isEnabled() const {
+#if defined(ICC_DISABLE_CONTEXT_STATS)
+    return false;
+#else
+    return enabled_.load(std::memory_order_relaxed);
+#endif
+  }
+
+  void enable(const bool _enable) {
+    if (_enable && !enabled_.load(std::memory_order_relaxed)) {
+      enable_time_ns_.store(nowNs(), std::memory_order_relaxed);
+    }
+    enabled_.store(_enable, std::memory_order_release);
+  }
+
+  /**
+   * Stamps pushed action with time of push to measure its wait and execution time
+   * @param _item Pushed action
+   */
+  void stamp(StampedAction &_item) {
+    const std::uint64_t kPushed = pushed_.fetch_add(1, std::memory_order_relaxed) + 1;
+    const std::uint64_t kDepth = kPushed -
+                                 started_.load(std::memory_order_relaxed) -
+                                 dropped_.load(std::memory_order_relaxed);
+    updateMax(max_queue_depth_, kDepth);
+    addToHistogram(queue_depth_histogram_, kDepth);
+    _item.push_time_ = Clock::now();
+  }
+
+  /**
+   * Executes action, stamped action reports its wait and execution time
+   * @param _item Popped action
+   */
+  void execute(StampedAction &_item) {
+    if (!_item.isStamped()) {
+      if (_item.action_) {
+        _item.action_();
+      }
+      return;
+    }
+    const Clock::time_point kStartTime = Clock::now();
+    onStart(kStartTime - _item.push_time_);
+    ExecutionGuard guard{*this, kStartTime};
+    if (_item.action_) {
+      _item.action_();
+    }
+  }
+
+  /**
+   * Called when stamped action was not executed because of overflow of queue
+   */
+  void onDrop() {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  ContextStats snapshot() const {
+    ContextStats stats;
+    stats.enabled_ = isEnabled();
+    stats.pushed_actions_ = pushed_.load(std::memory_order_relaxed);
+    stats.executed_actions_ = executed_.load(std::memory_order_relaxed);
+    stats.dropped_actions_ = dropped_.load(std::memory_order_relaxed);
+    const std::uint64_t kStarted = started_.load(std::memory_order_relaxed);
+    const std::uint64_t kDone = kStarted + stats.dropped_actions_;
+    stats.queue_depth_ = stats.pushed_actions_ > kDone ? stats.pushed_actions_ - kDone : 0;
+    stats.max_queue_depth_ = max_queue_depth_.load(std::memory_order_relaxed);
+    stats.total_wait_time_ = std::chrono::nanoseconds(total_wait_ns_.load(std::memory_order_relaxed));
+    stats.total_execution_time_ = std::chrono::nanoseconds(total_execution_ns_.load(std::memory_order_relaxed));
+    for (std::size_t i = 0; i < ContextStats::kNumOfBuckets; ++i) {
+      stats.queue_depth_histogram_[i] = queue_depth_histogram_[i].load(std::memory_order_relaxed);
+      stats.wait_time_histogram_[i] = wait_time_histogram_[i].load(std::memory_order_relaxed);
+      stats.execution_time_histogram_[i] = execution_time_histogram_[i].load(std::memory_order_relaxed);
+    }
+    const std::uint64_t kEnableTimeNs = enable_time_ns_.load(std::memory_order_relaxed);
+    if (kEnableTimeNs != 0) {
+      stats.uptime_ = std::chrono::nanoseconds(nowNs() - kEnableTimeNs);
+    }
+    if (stats.uptime_.count() > 0) {
+      stats.actions_per_second_ = static_cast<double>(stats.executed_actions_) * 1e9 /
+                                  static_cast<double>(stats.uptime_.count());
+    }
+    return stats;
+  }
+
+ private:
+  struct ExecutionGuard {
+    ExecutionGuard(StatsRecorder &_recorder, Clock::time_point _startTime)
+      : recorder_(_recorder)
+      , start_time_(_startTime) {
+    }
+
+    ~ExecutionGuard() {
+      recorder_.onFinish(Clock::now() - start_time_);
+    }
+
+    StatsRecorder &recorder_;
+    Clock::time_point start_time_;
+  };
+
+  using AtomicHistogram = std::atomic<std::uint64_t>[ContextStats::kNumOfBuckets];
+
+  static std::uint64_t nowNs() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count());
+  }
+
+  static std::uint64_t toNs(Clock::duration _duration) {
+    const auto kNs = std::chrono::duration_cast<std::chrono::nanoseconds>(_duration).count();
+    return kNs > 0 ? static_cast<std::uint64_t>(kNs) : 0;
+  }
+
+  static void addToHistogram(AtomicHistogram &_histogram, std::uint64_t _value) {
+    std::size_t bucketIdx = 0;
+    while (_value > 1 && bucketIdx + 1 < ContextStats::kNumOfBuckets) {
+      _value >>= 1;
+      ++bucketIdx;
+    }
+    _histogram[bucketIdx].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static void updateMax(std::atomic<std::uint64_t> &_max, const std::uint64_t _value) {
+    std::uint64_t prevMax = _max.load(std::memory_order_relaxed);
+    while (prevMax < _value &&
+           !_max.compare_exchange_weak(prevMax, _value, std::memory_order_relaxed));
+  }
+
+  void onStart(Clock::duration _waitTime) {
+    const std::uint64_t kWaitNs = toNs(_waitTime);
+    started_.fetch_add(1, std::memory_order_relaxed);
+    total_wait_ns_.fetch_add(kWaitNs, std::memory_order_relaxed);
+    addToHistogram(wait_time_histogram_, kWaitNs);
+  }
+
+  void onFinish(Clock::duration _executionTime) {
+    const std::uint64_t kExecutionNs = toNs(_executionTime);
+    executed_.fetch_add(1, std::memory_order_relaxed);
+    total_execution_ns_.fetch_add(kExecutionNs, std::memory_order_relaxed);
+    addToHistogram(execution_time_histogram_, kExecutionNs);
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<std::uint64_t> enable_time_ns_{0};
+  std::atomic<std::uint64_t> pushed_{0};
+  std::atomic<std::uint64_t> started_{0};
+  std::atomic<std::uint64_t> executed_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> max_queue_depth_{0};
+  std::atomic<std::uint64_t> total_wait_ns_{0};
+  std::atomic<std::uint64_t> total_execution_ns_{0};
+  AtomicHistogram queue_depth_histogram_ = {};
+  AtomicHistogram wait_time_histogram_ = {};
+  AtomicHistogram execution_time_histogram_ = {};
+};
+
+}
+
+}
+
+#endif //ICC_STATS_HELPERS_HPP
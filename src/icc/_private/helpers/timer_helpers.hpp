@@ -0,0 +1,100 @@
+/**
+ * @file timer_helpers.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains ContextTimers that keeps delayed and periodic actions of
+ * context. Timers are owned by context thread, other threads add them
+ * through mailbox of context, so no file descriptor or lock is needed per timer
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_TIMER_HELPERS_HPP
+#define ICC_TIMER_HELPERS_HPP
+
+#include <utility>
+
+#include <icc/Action.hpp>
+#include <icc/_private/containers/TimerQueue.hpp>
+
+namespace icc {
+
+namespace helpers {
+
+class ContextTimers {
+ public:
+  using TimerClock = _private::containers::TimerClock;
+  using TimerHandle = _private::containers::TimerHandle;
+
+  /**
+   * Action that adds timer on context thread
+   */
+  class AddTimerAction {
+   public:
+    AddTimerAction(ContextTimers &_timers, Action _action,
+                   TimerClock::time_point _timePoint,
+                   TimerClock::duration _period,
+                   TimerHandle _handle)
+      : timers_(&_timers)
+      , action_(std::move(_action))
+      , time_point_(_timePoint)
+      , period_(_period)
+      , handle_(std::move(_handle)) {
+    }
+
+    void operator()() {
+      timers_->add(std::move(action_), time_point_, period_, std::move(handle_));
+    }
+
+   private:
+    ContextTimers *timers_;
+    Action action_;
+    TimerClock::time_point time_point_;
+    TimerClock::duration period_;
+    TimerHandle handle_;
+  };
+
+  /**
+   * Adds timer, should be called only from context thread
+   */
+  void add(Action _action, TimerClock::time_point _timePoint,
+           TimerClock::duration _period, TimerHandle _handle) {
+    queue_.push(std::move(_action), _timePoint, _period, std::move(_handle));
+  }
+
+  /**
+   * Executes actions of expired timers, should be called only from context thread
+   * @return Time point of the next timer used as timeout of waiting for mailbox
+   */
+  TimerClock::time_point executeExpired() {
+    if (queue_.empty()) {
+      return TimerClock::time_point::max();
+    }
+    queue_.handleExpired(TimerClock::now(), [](Action &_action) {
+      if (_action) {
+        _action();
+      }
+    });
+    return queue_.nextTimePoint();
+  }
+
+  /**
+   * Time point of the next timer, should be called only from context thread
+   * @return Time point of the next timer, TimerClock::time_point::max() if there are no timers
+   */
+  TimerClock::time_point nextTimePoint() {
+    return queue_.nextTimePoint();
+  }
+
+  std::size_t count() const {
+    return queue_.count();
+  }
+
+ private:
+  _private::containers::TimerQueue<Action> queue_;
+};
+
+}
+
+}
+
+#endif //ICC_TIMER_HELPERS_HPP
@@ -0,0 +1,190 @@
+/**
+ * @file FramePool.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains FramePool class.
+ * Size-class pools of coroutine frames owned by the thread that creates
+ * coroutine, frames released on other threads are returned to the owner
+ * through lock-free remote free list
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_COROUTINE_FRAMEPOOL_HPP
+#define ICC_COROUTINE_FRAMEPOOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace icc {
+
+namespace coroutine {
+
+class FramePool {
+ public:
+  static constexpr std::size_t kNumSizeClasses = 6;
+  static constexpr std::size_t kMinBlockSize = 128;
+  static constexpr std::size_t kMaxBlockSize = kMinBlockSize << (kNumSizeClasses - 1);
+
+  FramePool(const FramePool &) = delete;
+  FramePool & operator=(const FramePool &) = delete;
+
+  /**
+   * Allocates frame from pool of calling thread,
+   * frames larger than kMaxBlockSize are allocated by global operator new
+   * @param _size Size of frame
+   * @return Pointer to frame
+   */
+  static void * allocate(const std::size_t _size) {
+    const std::size_t kSizeClass = sizeClass(_size + sizeof(Header));
+    FramePool *pool = threadPool();
+    Header *header = nullptr;
+    if (kSizeClass == kOversize || pool == nullptr) {
+      header = static_cast<Header *>(::operator new(_size + sizeof(Header)));
+      header->pool_ = nullptr;
+      header->size_class_ = kOversize;
+    } else {
+      header = pool->acquire(kSizeClass);
+    }
+    return header + 1;
+  }
+
+  /**
+   * Returns frame to pool of thread that allocated it
+   * @param _frame Pointer to frame returned by allocate
+   */
+  static void deallocate(void *_frame) {
+    Header *header = static_cast<Header *>(_frame) - 1;
+    FramePool *const kOwner = header->pool_;
+    if (kOwner == nullptr) {
+      ::operator delete(header);
+      return;
+    }
+    // NOTE(redra): Thread that only frees frames should not get its own pool
+    if (kOwner == threadState().pool_) {
+      header->next_ = kOwner->free_blocks_[header->size_class_];
+      kOwner->free_blocks_[header->size_class_] = header;
+    } else {
+      kOwner->pushRemote(header);
+    }
+    if (kOwner->release()) {
+      delete kOwner;
+    }
+  }
+
+ private:
+  static constexpr std::size_t kOversize = kNumSizeClasses;
+
+  struct alignas(std::max_align_t) Header {
+    FramePool *pool_;
+    std::size_t size_class_;
+    Header *next_;
+  };
+
+  struct ThreadState {
+    FramePool *pool_ = nullptr;
+    bool is_exited_ = false;
+  };
+
+  /**
+   * Releases pool of thread on its exit,
+   * pool is deleted when the last frame allocated from it is released
+   */
+  struct ThreadOwner {
+    ~ThreadOwner() {
+      ThreadState &state = threadState();
+      state.is_exited_ = true;
+      FramePool *const kPool = state.pool_;
+      state.pool_ = nullptr;
+      if (kPool != nullptr && kPool->release()) {
+        delete kPool;
+      }
+    }
+  };
+
+  FramePool() = default;
+
+  ~FramePool() {
+    for (std::size_t i = 0; i < kNumSizeClasses; ++i) {
+      freeList(free_blocks_[i]);
+      freeList(remote_blocks_[i].exchange(nullptr, std::memory_order_acquire));
+    }
+  }
+
+  static ThreadState & threadState() {
+    static thread_local ThreadState state;
+    return state;
+  }
+
+  static FramePool * threadPool() {
+    ThreadState &state = threadState();
+    if (state.pool_ == nullptr && !state.is_exited_) {
+      static thread_local ThreadOwner owner;
+      state.pool_ = new FramePool();
+    }
+    return state.pool_;
+  }
+
+  static std::size_t sizeClass(const std::size_t _size) {
+    std::size_t blockSize = kMinBlockSize;
+    for (std::size_t i = 0; i < kNumSizeClasses; ++i, blockSize <<= 1) {
+      if (_size <= blockSize) {
+        return i;
+      }
+    }
+    return kOversize;
+  }
+
+  static void freeList(Header *_header) {
+    while (_header != nullptr) {
+      Header *const kNext = _header->next_;
+      ::operator delete(_header);
+      _header = kNext;
+    }
+  }
+
+  Header * acquire(const std::size_t _sizeClass) {
+    Header *header = free_blocks_[_sizeClass];
+    if (header == nullptr) {
+      // NOTE(redra): Only owner takes remote list and it takes it whole, so there is no ABA
+      header = remote_blocks_[_sizeClass].exchange(nullptr, std::memory_order_acquire);
+    }
+    if (header != nullptr) {
+      free_blocks_[_sizeClass] = header->next_;
+    } else {
+      header = static_cast<Header *>(::operator new(kMinBlockSize << _sizeClass));
+      header->pool_ = this;
+      header->size_class_ = _sizeClass;
+    }
+    refs_.fetch_add(1, std::memory_order_relaxed);
+    return header;
+  }
+
+  void pushRemote(Header *_header) {
+    std::atomic<Header *> &list = remote_blocks_[_header->size_class_];
+    Header *head = list.load(std::memory_order_relaxed);
+    do {
+      _header->next_ = head;
+    } while (!list.compare_exchange_weak(head, _header,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  /**
+   * Pool is referenced by its thread and by every frame allocated from it
+   * @return true if it was the last reference
+   */
+  bool release() {
+    return refs_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  Header *free_blocks_[kNumSizeClasses] = {};
+  std::atomic<Header *> remote_blocks_[kNumSizeClasses] = {};
+  std::atomic<std::size_t> refs_{1};
+};
+
+}
+
+}
+
+#endif //ICC_COROUTINE_FRAMEPOOL_HPP
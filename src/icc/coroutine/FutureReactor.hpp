@@ -0,0 +1,134 @@
+/**
+ * @file FutureReactor.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains FutureReactor class.
+ * Single thread that watches future-like objects awaited by coroutines
+ * and calls completion action when they become ready, so co_await
+ * on future does not create a thread per await
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_COROUTINE_FUTUREREACTOR_HPP
+#define ICC_COROUTINE_FUTUREREACTOR_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <icc/Action.hpp>
+
+namespace icc {
+
+namespace coroutine {
+
+class FutureReactor {
+ public:
+  using ReadyCheck = std::function<bool(void)>;
+
+  /**
+   * Reactor shared by all coroutines, its thread is started on the first watch
+   */
+  static FutureReactor & getInstance() {
+    static FutureReactor reactor;
+    return reactor;
+  }
+
+  FutureReactor(const FutureReactor &) = delete;
+  FutureReactor & operator=(const FutureReactor &) = delete;
+
+  ~FutureReactor() {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      is_stopped_ = true;
+    }
+    cond_var_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  /**
+   * Watches object until _isReady returns true, then calls _onReady
+   * from thread of reactor
+   * @param _isReady Non blocking check of readiness
+   * @param _onReady Action that schedules resumption of awaiting coroutine
+   */
+  void watch(ReadyCheck _isReady, Action _onReady) {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      added_watches_.push_back(Watch{std::move(_isReady), std::move(_onReady)});
+      if (!thread_.joinable()) {
+        thread_ = std::thread(&FutureReactor::run, this);
+      }
+    }
+    cond_var_.notify_one();
+  }
+
+ private:
+  struct Watch {
+    ReadyCheck is_ready_;
+    Action on_ready_;
+  };
+
+  FutureReactor() = default;
+
+  /**
+   * Future-like objects do not notify about readiness, so they are polled.
+   * Interval grows while nothing becomes ready and is reset otherwise
+   */
+  void run() {
+    const std::chrono::microseconds kMinPollInterval{50};
+    const std::chrono::microseconds kMaxPollInterval{5000};
+    std::vector<Watch> watches;
+    std::chrono::microseconds pollInterval = kMinPollInterval;
+    std::unique_lock<std::mutex> lock{mtx_};
+    while (!is_stopped_) {
+      for (auto &watch : added_watches_) {
+        watches.push_back(std::move(watch));
+      }
+      added_watches_.clear();
+      if (watches.empty()) {
+        cond_var_.wait(lock, [this] {
+          return is_stopped_ || !added_watches_.empty();
+        });
+        continue;
+      }
+      lock.unlock();
+      const std::size_t kNumWatches = watches.size();
+      watches.erase(std::remove_if(watches.begin(), watches.end(), [](Watch &_watch) {
+        if (!_watch.is_ready_()) {
+          return false;
+        }
+        _watch.on_ready_();
+        return true;
+      }), watches.end());
+      pollInterval = watches.size() != kNumWatches
+                     ? kMinPollInterval
+                     : std::min(pollInterval * 2, kMaxPollInterval);
+      lock.lock();
+      if (!watches.empty()) {
+        cond_var_.wait_for(lock, pollInterval, [this] {
+          return is_stopped_ || !added_watches_.empty();
+        });
+      }
+    }
+  }
+
+  std::mutex mtx_;
+  std::condition_variable cond_var_;
+  bool is_stopped_ = false;
+  std::vector<Watch> added_watches_;
+  std::thread thread_;
+};
+
+}
+
+}
+
+#endif //ICC_COROUTINE_FUTUREREACTOR_HPP
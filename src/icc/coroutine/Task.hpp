@@ -2,7 +2,12 @@
  * @file Task.hpp
  * @author Denis Kotov
  * @date 18 Apr 2018
- * @brief Suspendable Task (coroutine)
+ * @brief Suspendable Task (coroutine).
+ * Completion of Task resumes awaiting coroutine on its Context through
+ * continuation stored in the coroutine frame, awaited Tasks on the same
+ * Context are started and resumed by symmetric transfer, frames are
+ * allocated from FramePool, future-like objects are awaited through
+ * FutureReactor, so co_await does not create threads
  * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
  */
 
@@ -15,17 +20,18 @@
 
 #if defined(__cpp_lib_coroutine)
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <exception>
 #include <type_traits>
-#include <iostream>
-#include <vector>
 #include <future>
 #include <memory>
-#include <shared_mutex>
-#include <condition_variable>
 #include <optional>
+#include <utility>
 #include <icc/Context.hpp>
-#include <chrono>
+#include "FramePool.hpp"
+#include "FutureReactor.hpp"
 
 namespace icc {
 
@@ -39,6 +45,92 @@ class TaskPromise;
 template<typename _R = void>
 class Task;
 
+/**
+ * Loop that resumes coroutines transferred to each other on this thread.
+ * Symmetric transfer is a tail call only when compiler optimizes it,
+ * so coroutines resumed through Trampoline do not grow stack with
+ * length of chain in any build
+ */
+class Trampoline {
+ public:
+  /**
+   * Resumes _coro and coroutines transferred from it
+   * @param _coro Coroutine to resume
+   */
+  static void resume(std::coroutine_handle<> _coro) {
+    Trampoline *const kOuter = current();
+    Trampoline trampoline;
+    current() = &trampoline;
+    while (_coro) {
+      trampoline.next_ = nullptr;
+      _coro.resume();
+      _coro = trampoline.next_;
+    }
+    current() = kOuter;
+  }
+
+  /**
+   * Used as result of await_suspend
+   * @param _coro Coroutine to transfer to
+   * @return Coroutine that compiler should resume
+   */
+  static std::coroutine_handle<> transfer(std::coroutine_handle<> _coro) {
+    Trampoline *const kTrampoline = current();
+    if (kTrampoline == nullptr) {
+      return _coro;
+    }
+    kTrampoline->next_ = _coro;
+    return std::noop_coroutine();
+  }
+
+ private:
+  static Trampoline *& current() {
+    static thread_local Trampoline *trampoline = nullptr;
+    return trampoline;
+  }
+
+  std::coroutine_handle<> next_;
+};
+
+/**
+ * Awaiting coroutine and channel of Context where it should be resumed
+ */
+class Continuation {
+ public:
+  Continuation() = default;
+  Continuation(std::coroutine_handle<> _coro, IContext::IChannel *_channel)
+      : coro_(_coro)
+      , channel_(_channel) {
+  }
+
+  explicit operator bool() const {
+    return static_cast<bool>(coro_);
+  }
+
+  std::coroutine_handle<> handle() const {
+    return coro_;
+  }
+
+  bool isOn(const IContext &_context) const {
+    return &channel_->getContext() == &_context;
+  }
+
+  void resume() const {
+    std::coroutine_handle<> coro = coro_;
+    channel_->push([coro] {
+      Trampoline::resume(coro);
+    });
+  }
+
+ private:
+  std::coroutine_handle<> coro_;
+  IContext::IChannel *channel_ = nullptr;
+};
+
+/**
+ * Awaiter of future-like object, e.g. std::future.
+ * Readiness is watched by FutureReactor instead of separate thread
+ */
 template<typename _AwaitableType>
 class TaskAwaiter {
  public:
@@ -46,20 +138,13 @@ class TaskAwaiter {
       : awaitable_(std::move(_awaitable)) {
   }
 
-  TaskAwaiter(TaskAwaiter<_AwaitableType> &&_awaitable)
-      : awaitable_(std::move(_awaitable.awaitable_)),
-        wait_thread_(std::move(_awaitable.wait_thread_)),
-        channel_(std::move(_awaitable.channel_)) {
-  }
-
-  ~TaskAwaiter() {
-    if (wait_thread_.joinable()) {
-      wait_thread_.join();
-    }
+  TaskAwaiter(TaskAwaiter<_AwaitableType> &&_awaiter)
+      : awaitable_(std::move(_awaiter.awaitable_)),
+        channel_(_awaiter.channel_) {
   }
 
   bool await_ready() {
-    return false;
+    return isReady();
   }
 
   auto await_resume() {
@@ -67,24 +152,32 @@ class TaskAwaiter {
   }
 
   void await_suspend(std::coroutine_handle<> _coro) {
-    wait_thread_ = std::thread([this, _coro] {
-      awaitable_.wait();
-      channel_->push([_coro]() mutable {
-        _coro.resume();
-      });
+    Continuation continuation{_coro, channel_};
+    FutureReactor::getInstance().watch([this] {
+      return isReady();
+    }, [continuation] {
+      continuation.resume();
     });
   }
 
-  void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
+  void setContextChannel(IContext::IChannel *_contextChannel) {
+    channel_ = _contextChannel;
   }
 
  private:
+  bool isReady() const {
+    return awaitable_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+
   _AwaitableType &&awaitable_;
-  std::thread wait_thread_;
-  std::unique_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
+/**
+ * Awaiter of Task, awaiting coroutine is stored as continuation of Task.
+ * Not started Task is started lazily by symmetric transfer from awaiting
+ * coroutine, so chains of Tasks on the same Context have no queue hops
+ */
 template<typename _R>
 class TaskAwaiter<Task<_R>> {
  public:
@@ -92,16 +185,9 @@ class TaskAwaiter<Task<_R>> {
       : awaitable_(std::move(_awaitable)) {
   }
 
-  TaskAwaiter(TaskAwaiter<Task<_R>> &&_awaitable)
-      : awaitable_(std::move(_awaitable.awaitable_)),
-        wait_thread_(std::move(_awaitable.wait_thread_)),
-        channel_(std::move(_awaitable.channel_)) {
-  }
-
-  ~TaskAwaiter() {
-    if (wait_thread_.joinable()) {
-      wait_thread_.join();
-    }
+  TaskAwaiter(TaskAwaiter<Task<_R>> &&_awaiter)
+      : awaitable_(std::move(_awaiter.awaitable_)),
+        channel_(_awaiter.channel_) {
   }
 
   bool await_ready() {
@@ -112,257 +198,305 @@ class TaskAwaiter<Task<_R>> {
     return awaitable_.get();
   }
 
-  void await_suspend(std::coroutine_handle<> _coro) {
-    wait_thread_ = std::thread([this, _coro] {
-      awaitable_.wait();
-      channel_->push([_coro]() mutable {
-        _coro.resume();
-      });
-    });
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> _coro) {
+    TaskPromise<_R> &promise = awaitable_.handle_.promise();
+    const bool kShouldStart = promise.bind(channel_);
+    continuation_ = Continuation{_coro, channel_};
+    if (!promise.setContinuation(&continuation_)) {
+      return _coro;
+    }
+    if (kShouldStart) {
+      return Trampoline::transfer(awaitable_.handle_);
+    }
+    return std::noop_coroutine();
   }
 
-  void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
+  void setContextChannel(IContext::IChannel *_contextChannel) {
+    channel_ = _contextChannel;
   }
 
  private:
   Task<_R> && awaitable_;
-  std::thread wait_thread_;
-  std::unique_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
+  // NOTE(redra): Lives in frame of awaiting coroutine until it is resumed
+  Continuation continuation_;
 };
 
-template<typename _R>
-class TaskPromise {
+/**
+ * Completion state of Task stored in the coroutine frame.
+ * Frame is referenced by copies of Task and by the coroutine itself while
+ * it is running, the last reference destroys the frame
+ */
+class TaskPromiseBase {
  public:
-  friend class Task<_R>;
+  /**
+   * Resumes awaiting coroutine directly if it is on the same Context,
+   * otherwise pushes it to its Context
+   */
+  class FinalAwaiter {
+   public:
+    bool await_ready() noexcept {
+      return false;
+    }
 
-  TaskPromise() = default;
-  ~TaskPromise() = default;
+    template<typename _Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<_Promise> _coro) noexcept {
+      TaskPromiseBase &promise = _coro.promise();
+      const std::coroutine_handle<> kNext = promise.complete();
+      if (promise.release()) {
+        _coro.destroy();
+      }
+      return kNext ? Trampoline::transfer(kNext) : std::noop_coroutine();
+    }
 
-  void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
+    void await_resume() noexcept {
+    }
+  };
+
+  /**
+   * Frames are taken from pool of thread that creates coroutine
+   */
+  static void * operator new(std::size_t _size) {
+    return FramePool::allocate(_size);
+  }
+
+  static void operator delete(void *_frame) {
+    FramePool::deallocate(_frame);
   }
 
   std::suspend_always initial_suspend() { return {}; }
-  std::suspend_never final_suspend() noexcept { return {}; }
+  FinalAwaiter final_suspend() noexcept { return {}; }
   template<typename _AwaitableType>
   auto await_transform(_AwaitableType &&_result) {
     auto awaiter = TaskAwaiter<_AwaitableType>{std::forward<_AwaitableType>(_result)};
-    awaiter.setContextChannel(channel_->getContext().createChannel());
+    awaiter.setContextChannel(channel_);
     return awaiter;
   }
   template<typename _F>
   auto await_transform(Task<_F> &&_result) {
-    _result.setContextChannel(channel_->getContext().createChannel());
-    _result.initialStart();
     auto awaiter = TaskAwaiter<Task<_F>>{std::move(_result)};
-    awaiter.setContextChannel(channel_->getContext().createChannel());
+    awaiter.setContextChannel(channel_);
     return awaiter;
   }
   template<typename _F>
   auto await_transform(std::optional<_F> &&_result) = delete;
-  auto get_return_object() {
-    return Task<_R>{*this};
-  }
-  void return_value(_R value) {
-    std::lock_guard<std::mutex> lock(*mutex_);
-    *result_ = value;
-    awaiter_->notify_one();
-  }
+  /**
+   * Exception is kept in promise and rethrown to caller of value(),
+   * so coroutine reaches final suspend and resumes its awaiting coroutine
+   */
   void unhandled_exception() {
-    std::rethrow_exception(std::current_exception());
+    exception_ = std::current_exception();
   }
 
- private:
-  std::shared_ptr<std::optional<_R>> result_ = std::make_shared<std::optional<_R>>();
-  std::shared_ptr<std::mutex> mutex_ = std::make_shared<std::mutex>();
-  std::shared_ptr<std::condition_variable> awaiter_ = std::make_shared<std::condition_variable>();
-  std::unique_ptr<IContext::IChannel> channel_;
-};
-
-template<typename _R>
-class Task {
- public:
-  template<typename _U>
-  friend class TaskPromise;
-  friend class TaskScheduler;
-  using HandleType = std::coroutine_handle<TaskPromise<_R> >;
+  bool isReady() const {
+    return state_.load(std::memory_order_acquire) == readyState();
+  }
 
-  Task(const Task<_R> &_request)
-      : promise_(_request.promise_),
-        result_(_request.result_),
-        mutex_(_request.mutex_),
-        awaiter_(_request.awaiter_),
-        channel_(_request.channel_) {
+  /**
+   * Blocks caller that is not a coroutine until task is completed
+   */
+  void wait() const {
+    void *state = state_.load(std::memory_order_acquire);
+    while (state != readyState()) {
+      state_.wait(state, std::memory_order_acquire);
+      state = state_.load(std::memory_order_acquire);
+    }
   }
 
-  Task(Task<_R> &&_request)
-      : promise_(_request.promise_),
-        result_(std::move(_request.result_)),
-        mutex_(std::move(_request.mutex_)),
-        awaiter_(std::move(_request.awaiter_)),
-        channel_(std::move(_request.channel_)) {
+  /**
+   * Stores continuation that is resumed when task is completed
+   * @param _continuation Awaiting coroutine, should outlive completion
+   * @return false if task is already completed and continuation is not stored
+   */
+  bool setContinuation(Continuation *_continuation) {
+    void *expected = nullptr;
+    return state_.compare_exchange_strong(expected, _continuation,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire);
   }
 
-  bool isReady() const {
-    return static_cast<bool>(*result_);
+  void addRef() {
+    refs_.fetch_add(1, std::memory_order_relaxed);
   }
 
-  void wait() const {
-    std::unique_lock<std::mutex> lock(*mutex_);
-    if (!*result_) {
-      awaiter_->wait(lock);
-    }
+  /**
+   * @return true if it was the last reference and frame should be destroyed
+   */
+  bool release() {
+    return refs_.fetch_sub(1, std::memory_order_acq_rel) == 1;
   }
 
-  _R get() const {
-    std::optional<_R> result;
-    if (*result_) {
-      result = *result_;
-    } else {
-      wait();
-      result = *result_;
+  /**
+   * Binds coroutine that is not started yet to Context of _channel
+   * @param _channel Channel borrowed from awaiting coroutine or owned by this one
+   * @return true if coroutine was not started and caller should resume it
+   */
+  bool bind(IContext::IChannel *_channel) {
+    if (is_started_) {
+      return false;
     }
-    return result.value();
+    is_started_ = true;
+    channel_ = _channel;
+    // NOTE(redra): Running coroutine keeps its frame until final suspend
+    addRef();
+    return true;
   }
 
  protected:
-  Task(TaskPromise<_R> &_promise)
-      : promise_(_promise), result_(promise_.result_), mutex_(promise_.mutex_), awaiter_(promise_.awaiter_) {
+  void rethrowIfFailed() const {
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
   }
 
-  void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
-    promise_.setContextChannel(channel_->getContext().createChannel());
+  void setOwnChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
+    own_channel_ = std::move(_contextChannel);
   }
 
-  void initialStart() {
-    if (channel_) {
-      channel_->invoke([=] {
-        HandleType::from_promise(promise_).resume();
-      });
-      channel_.reset();
-    }
+  IContext::IChannel * ownChannel() const {
+    return own_channel_.get();
   }
 
  private:
-  TaskPromise<_R> &promise_;
-  std::shared_ptr<std::optional<_R>> result_;
-  std::shared_ptr<std::mutex> mutex_;
-  std::shared_ptr<std::condition_variable> awaiter_;
-  std::unique_ptr<IContext::IChannel> channel_;
+  /**
+   * State holds nullptr while task is pending, pointer to continuation
+   * when it is awaited and address of promise when it is completed
+   */
+  void * readyState() const {
+    return const_cast<TaskPromiseBase *>(this);
+  }
+
+  /**
+   * @return Awaiting coroutine that should be resumed by symmetric transfer,
+   *         empty handle if there is no one
+   */
+  std::coroutine_handle<> complete() {
+    std::coroutine_handle<> next;
+    void *previous = state_.exchange(readyState(), std::memory_order_acq_rel);
+    if (previous != nullptr) {
+      const Continuation &continuation = *static_cast<Continuation *>(previous);
+      if (continuation.isOn(channel_->getContext())) {
+        next = continuation.handle();
+      } else {
+        continuation.resume();
+      }
+    }
+    // NOTE(redra): Owned channel should not keep Context alive after completion
+    own_channel_.reset();
+    state_.notify_all();
+    return next;
+  }
+
+  IContext::IChannel *channel_ = nullptr;
+  std::unique_ptr<IContext::IChannel> own_channel_;
+  std::exception_ptr exception_;
+  mutable std::atomic<void *> state_{nullptr};
+  std::atomic<std::uint32_t> refs_{0};
+  bool is_started_ = false;
 };
 
-template<>
-class TaskPromise<void> {
+template<typename _R>
+class TaskPromise : public TaskPromiseBase {
  public:
-  friend class Task<void>;
+  friend class Task<_R>;
+  friend class TaskPromiseBase;
 
-  TaskPromise() {
+  auto get_return_object() {
+    return Task<_R>{*this};
   }
-
-  ~TaskPromise() {
+  void return_value(_R value) {
+    value_.emplace(std::move(value));
   }
 
-  void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
+  _R value() const {
+    rethrowIfFailed();
+    return *value_;
   }
 
-  std::suspend_always initial_suspend() { return {}; }
-  std::suspend_never final_suspend() noexcept { return {}; }
-  template<typename _AwaitableType>
-  auto await_transform(_AwaitableType &&_result) {
-    auto awaiter = TaskAwaiter<_AwaitableType>{std::forward<_AwaitableType>(_result)};
-    awaiter.setContextChannel(channel_->getContext().createChannel());
-    return awaiter;
-  }
-  template<typename _F>
-  auto await_transform(Task<_F> &&_result) {
-    _result.setContextChannel(channel_->getContext().createChannel());
-    _result.initialStart();
-    auto awaiter = TaskAwaiter<Task<_F>>{std::move(_result)};
-    awaiter.setContextChannel(channel_->getContext().createChannel());
-    return awaiter;
-  }
-  template<typename _F>
-  auto await_transform(std::optional<_F> &&_result) = delete;
+ private:
+  std::optional<_R> value_;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase {
+ public:
+  friend class Task<void>;
+  friend class TaskPromiseBase;
+
   auto get_return_object();
   void return_void() {
-    std::lock_guard<std::mutex> lock(*mutex_);
-    *is_ready_ = true;
-    awaiter_->notify_one();
-  }
-  void unhandled_exception() {
-    std::rethrow_exception(std::current_exception());
   }
 
- private:
-  std::shared_ptr<bool> is_ready_ = std::make_shared<bool>();
-  std::shared_ptr<std::mutex> mutex_ = std::make_shared<std::mutex>();
-  std::shared_ptr<std::condition_variable> awaiter_ = std::make_shared<std::condition_variable>();
-  std::unique_ptr<IContext::IChannel> channel_;
+  void value() const {
+    rethrowIfFailed();
+  }
 };
 
-template<>
-class Task<void> {
+template<typename _R>
+class Task {
  public:
   template<typename _U>
   friend class TaskPromise;
+  template<typename _U>
+  friend class TaskAwaiter;
+  friend class TaskPromiseBase;
   friend class TaskScheduler;
-  using HandleType = std::coroutine_handle<TaskPromise<void> >;
+  using HandleType = std::coroutine_handle<TaskPromise<_R> >;
 
-  Task(const Task<void> &_request)
-      : promise_(_request.promise_),
-        is_ready_(promise_.is_ready_),
-        mutex_(_request.mutex_),
-        awaiter_(_request.awaiter_),
-        channel_(_request.channel_->getContext().createChannel()) {
+  Task(const Task<_R> &_request)
+      : handle_(_request.handle_) {
+    if (handle_) {
+      handle_.promise().addRef();
+    }
   }
 
-  Task(Task<void> &&_request)
-      : promise_(_request.promise_),
-        is_ready_(promise_.is_ready_),
-        mutex_(std::move(_request.mutex_)),
-        awaiter_(std::move(_request.awaiter_)),
-        channel_(std::move(_request.channel_)) {
+  Task(Task<_R> &&_request)
+      : handle_(std::exchange(_request.handle_, nullptr)) {
   }
 
-  bool isReady() {
-    return *is_ready_;
+  Task<_R> & operator=(const Task<_R> &) = delete;
+
+  ~Task() {
+    if (handle_ && handle_.promise().release()) {
+      handle_.destroy();
+    }
+  }
+
+  bool isReady() const {
+    return handle_.promise().isReady();
   }
 
   void wait() const {
-    std::unique_lock<std::mutex> lock(*mutex_);
-    if (!*is_ready_) {
-      awaiter_->wait(lock);
-    }
+    handle_.promise().wait();
+  }
+
+  _R get() const {
+    wait();
+    return handle_.promise().value();
   }
 
  protected:
-  Task(TaskPromise<void> &_promise)
-      : promise_(_promise), is_ready_(promise_.is_ready_), mutex_(promise_.mutex_), awaiter_(promise_.awaiter_) {
+  Task(TaskPromise<_R> &_promise)
+      : handle_(HandleType::from_promise(_promise)) {
+    _promise.addRef();
   }
 
   void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
-    promise_.setContextChannel(channel_->getContext().createChannel());
+    handle_.promise().setOwnChannel(std::move(_contextChannel));
   }
 
   void initialStart() {
-    if (channel_) {
-      channel_->invoke([=] {
-        HandleType::from_promise(promise_).resume();
+    TaskPromise<_R> &promise = handle_.promise();
+    if (promise.bind(promise.ownChannel())) {
+      HandleType handle = handle_;
+      promise.ownChannel()->invoke([handle] {
+        Trampoline::resume(handle);
       });
-      channel_.reset();
     }
   }
 
  private:
-  TaskPromise<void> & promise_;
-  std::shared_ptr<bool> is_ready_;
-  std::shared_ptr<std::mutex> mutex_;
-  std::shared_ptr<std::condition_variable> awaiter_;
-  std::unique_ptr<IContext::IChannel> channel_;
+  HandleType handle_;
 };
 
 inline
@@ -370,51 +504,6 @@ auto TaskPromise<void>::get_return_object() {
   return Task<void>{*this};
 }
 
-template<>
-class TaskAwaiter<Task<void>> {
- public:
-  TaskAwaiter(Task<void> &&_awaitable)
-      : awaitable_(std::move(_awaitable)) {
-  }
-
-  TaskAwaiter(TaskAwaiter<Task<void>> &&_awaiter)
-      : awaitable_(std::move(_awaiter.awaitable_)),
-        wait_thread_(std::move(_awaiter.wait_thread_)),
-        channel_(std::move(_awaiter.channel_)) {
-  }
-
-  ~TaskAwaiter() {
-    if (wait_thread_.joinable()) {
-      wait_thread_.join();
-    }
-  }
-
-  bool await_ready() {
-    return awaitable_.isReady();
-  }
-
-  void await_resume() {
-  }
-
-  void await_suspend(std::coroutine_handle<> _coro) {
-    wait_thread_ = std::thread([this, _coro] {
-      awaitable_.wait();
-      channel_->push([_coro]() mutable {
-        _coro.resume();
-      });
-    });
-  }
-
-  void setContextChannel(std::unique_ptr<IContext::IChannel> _contextChannel) {
-    channel_ = std::move(_contextChannel);
-  }
-
- private:
-  Task<void> && awaitable_;
-  std::thread wait_thread_;
-  std::unique_ptr<IContext::IChannel> channel_;
-};
-
 }
 
 }
@@ -28,6 +28,7 @@
 #include <icc/os/timer/ITimerListener.hpp>
 #include <icc/os/timer/Timer.hpp>
 #include <icc/os/EventLoop.hpp>
+#include "Task.hpp"
 
 namespace icc {
 
@@ -46,7 +47,7 @@ class TaskAwaiter<boost::posix_time::time_duration>
   TaskAwaiter(TaskAwaiter<boost::posix_time::time_duration> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -66,13 +67,13 @@ class TaskAwaiter<boost::posix_time::time_duration>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -80,7 +81,7 @@ class TaskAwaiter<boost::posix_time::time_duration>
   std::coroutine_handle<> coro_;
   boost::posix_time::time_duration duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -95,7 +96,7 @@ class TaskAwaiter<boost::posix_time::hours>
   TaskAwaiter(TaskAwaiter<boost::posix_time::hours> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -115,13 +116,13 @@ class TaskAwaiter<boost::posix_time::hours>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -129,7 +130,7 @@ class TaskAwaiter<boost::posix_time::hours>
   std::coroutine_handle<> coro_;
   boost::posix_time::hours duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -144,7 +145,7 @@ class TaskAwaiter<boost::posix_time::minutes>
   TaskAwaiter(TaskAwaiter<boost::posix_time::minutes> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -164,13 +165,13 @@ class TaskAwaiter<boost::posix_time::minutes>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -178,7 +179,7 @@ class TaskAwaiter<boost::posix_time::minutes>
   std::coroutine_handle<> coro_;
   boost::posix_time::minutes duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -193,7 +194,7 @@ class TaskAwaiter<boost::posix_time::seconds>
   TaskAwaiter(TaskAwaiter<boost::posix_time::seconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -213,13 +214,13 @@ class TaskAwaiter<boost::posix_time::seconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -227,7 +228,7 @@ class TaskAwaiter<boost::posix_time::seconds>
   std::coroutine_handle<> coro_;
   boost::posix_time::seconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -242,7 +243,7 @@ class TaskAwaiter<boost::posix_time::milliseconds>
   TaskAwaiter(TaskAwaiter<boost::posix_time::milliseconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -262,13 +263,13 @@ class TaskAwaiter<boost::posix_time::milliseconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -276,7 +277,7 @@ class TaskAwaiter<boost::posix_time::milliseconds>
   std::coroutine_handle<> coro_;
   boost::posix_time::milliseconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -291,7 +292,7 @@ class TaskAwaiter<boost::posix_time::microseconds>
   TaskAwaiter(TaskAwaiter<boost::posix_time::microseconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -311,13 +312,13 @@ class TaskAwaiter<boost::posix_time::microseconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -325,7 +326,7 @@ class TaskAwaiter<boost::posix_time::microseconds>
   std::coroutine_handle<> coro_;
   boost::posix_time::microseconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 #ifdef BOOST_DATE_TIME_HAS_NANOSECONDS
@@ -342,7 +343,7 @@ class TaskAwaiter<boost::posix_time::nanoseconds>
   TaskAwaiter(TaskAwaiter<boost::posix_time::nanoseconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -362,13 +363,13 @@ class TaskAwaiter<boost::posix_time::nanoseconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -376,7 +377,7 @@ class TaskAwaiter<boost::posix_time::nanoseconds>
   std::coroutine_handle<> coro_;
   boost::posix_time::nanoseconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 #endif
@@ -395,7 +396,7 @@ class TaskAwaiter<std::chrono::duration<_Rep, _Period>>
   TaskAwaiter(TaskAwaiter<std::chrono::duration<_Rep, _Period>> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -415,13 +416,13 @@ class TaskAwaiter<std::chrono::duration<_Rep, _Period>>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -429,7 +430,7 @@ class TaskAwaiter<std::chrono::duration<_Rep, _Period>>
   std::coroutine_handle<> coro_;
   std::chrono::seconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -444,7 +445,7 @@ class TaskAwaiter<std::chrono::hours>
   TaskAwaiter(TaskAwaiter<std::chrono::hours> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -464,13 +465,13 @@ class TaskAwaiter<std::chrono::hours>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -478,7 +479,7 @@ class TaskAwaiter<std::chrono::hours>
   std::coroutine_handle<> coro_;
   std::chrono::seconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -493,7 +494,7 @@ class TaskAwaiter<std::chrono::minutes>
   TaskAwaiter(TaskAwaiter<std::chrono::minutes> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -513,13 +514,13 @@ class TaskAwaiter<std::chrono::minutes>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -527,7 +528,7 @@ class TaskAwaiter<std::chrono::minutes>
   std::coroutine_handle<> coro_;
   std::chrono::seconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -542,7 +543,7 @@ class TaskAwaiter<std::chrono::seconds>
   TaskAwaiter(TaskAwaiter<std::chrono::seconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -562,13 +563,13 @@ class TaskAwaiter<std::chrono::seconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -576,7 +577,7 @@ class TaskAwaiter<std::chrono::seconds>
   std::coroutine_handle<> coro_;
   std::chrono::seconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -591,7 +592,7 @@ class TaskAwaiter<std::chrono::milliseconds>
   TaskAwaiter(TaskAwaiter<std::chrono::milliseconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -611,13 +612,13 @@ class TaskAwaiter<std::chrono::milliseconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -625,7 +626,7 @@ class TaskAwaiter<std::chrono::milliseconds>
   std::coroutine_handle<> coro_;
   std::chrono::milliseconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -640,7 +641,7 @@ class TaskAwaiter<std::chrono::microseconds>
   TaskAwaiter(TaskAwaiter<std::chrono::microseconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -660,13 +661,13 @@ class TaskAwaiter<std::chrono::microseconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -674,7 +675,7 @@ class TaskAwaiter<std::chrono::microseconds>
   std::coroutine_handle<> coro_;
   std::chrono::microseconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 template <>
@@ -689,7 +690,7 @@ class TaskAwaiter<std::chrono::nanoseconds>
   TaskAwaiter(TaskAwaiter<std::chrono::nanoseconds> && _awaiter)
       : duration_(std::move(_awaiter.duration_))
       , timer_(std::move(_awaiter.timer_))
-      , channel_(std::move(_awaiter.channel_)) {
+      , channel_(_awaiter.channel_) {
   }
 
   ~TaskAwaiter() {
@@ -709,13 +710,13 @@ class TaskAwaiter<std::chrono::nanoseconds>
     timer_->start();
   }
 
-  void setContextChannel(std::shared_ptr<IContext::IChannel> _contextChannel) {
+  void setContextChannel(IContext::IChannel *_contextChannel) {
     channel_ = _contextChannel;
   }
 
   void onTimerExpired() override {
     channel_->push([=] {
-      coro_.resume();
+      Trampoline::resume(coro_);
     });
   }
 
@@ -723,7 +724,7 @@ class TaskAwaiter<std::chrono::nanoseconds>
   std::coroutine_handle<> coro_;
   std::chrono::nanoseconds duration_;
   std::shared_ptr<icc::os::Timer> timer_;
-  std::shared_ptr<IContext::IChannel> channel_;
+  IContext::IChannel *channel_ = nullptr;
 };
 
 }
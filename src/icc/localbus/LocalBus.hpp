@@ -77,7 +77,7 @@ class ICC_PUBLIC LocalBus
           if (auto _client = weak_client.lock()) {
             _client->push([=]() mutable {
               _client->connected(_service.get());
-            });
+            }, Priority::High);
             ++client;
           } else {
             // NOTE(redra): Deleting client
@@ -110,7 +110,7 @@ class ICC_PUBLIC LocalBus
           if (auto _client = weak_client.lock()) {
             _client->push([=]() mutable {
               _client->disconnected(nullptr);
-            });
+            }, Priority::High);
             ++client;
           } else {
             // NOTE(redra): Deleting client
@@ -144,7 +144,7 @@ class ICC_PUBLIC LocalBus
         if (service) {
           _client->invoke([=]() mutable {
             _client->connected(service.get());
-          });
+          }, Priority::High);
         }
       }
     });
@@ -49,6 +49,14 @@ bool EventLoop::isRun() const {
   return impl_ptr_->isRun();
 }
 
+void EventLoop::push(Action _action) {
+  impl_ptr_->push(std::move(_action));
+}
+
+std::thread::id EventLoop::getThreadId() const {
+  return impl_ptr_->getThreadId();
+}
+
 std::shared_ptr<Timer> EventLoop::createTimer() {
   auto timerImpl = impl_ptr_->createTimerImpl();
   if (!timerImpl) {
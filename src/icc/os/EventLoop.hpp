@@ -42,6 +42,19 @@ class ICC_PUBLIC EventLoop : public IEventLoop {
   void stop() override;
   bool isRun() const override;
 
+  /**
+   * Pushes action that is executed on thread of event loop
+   * within the next loop iteration. Could be called from any thread
+   * @param _action Action to execute
+   */
+  void push(Action _action);
+
+  /**
+   * Method used to get thread that runs event loop
+   * @return Id of thread, default id if event loop is not run
+   */
+  std::thread::id getThreadId() const;
+
   std::shared_ptr<Timer> createTimer();
   std::shared_ptr<ServerSocket> createServerSocket(std::string _address, uint16_t _port, uint16_t _numQueue);
   std::shared_ptr<ServerSocket> createServerSocket(const Handle & _serverSocketHandle);
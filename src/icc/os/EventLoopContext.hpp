@@ -0,0 +1,298 @@
+/**
+ * @file EventLoopContext.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains Context<os::EventLoop>, also known as EventLoopContext.
+ * It is implementation of IContext interface that executes actions
+ * on thread of os::EventLoop. Pushed actions are drained within the same
+ * loop iteration as fd readiness callbacks, so Components, Timers and Sockets
+ * could share one thread without handoff between threads.
+ * Delayed and periodic actions share single os::Timer of context
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_OS_EVENTLOOPCONTEXT_HPP
+#define ICC_OS_EVENTLOOPCONTEXT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <icc/Context.hpp>
+#include "EventLoop.hpp"
+#include "timer/Timer.hpp"
+
+namespace icc {
+
+template <>
+class Context<os::EventLoop> final
+    : public ContextBase
+    , public std::enable_shared_from_this<Context<os::EventLoop>> {
+ public:
+  class Channel : public IContext::IChannel {
+   public:
+    explicit Channel(std::shared_ptr<Context> context)
+      : context_{std::move(context)} {
+      context_->num_of_channels_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    ~Channel() override {
+      const uint32_t kPrevNumWorkers = context_->num_of_channels_.fetch_sub(1, std::memory_order_acq_rel);
+      if (1 == kPrevNumWorkers) {
+        context_->onLastChannelDestroyed();
+      }
+    }
+
+    void push(Action _action) override {
+      if (context_) {
+        context_->push(std::move(_action));
+      }
+    }
+
+    void invoke(Action _action) override {
+      if (context_) {
+        context_->invoke(std::move(_action));
+      }
+    }
+
+    TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) override {
+      if (context_) {
+        return context_->pushAt(_timePoint, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+    TimerHandle pushEvery(TimerClock::duration _period, Action _action) override {
+      if (context_) {
+        return context_->pushEvery(_period, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+#if __cpp_lib_optional >= 201606L
+    [[nodiscard]]
+#endif
+    IContext & getContext() const override {
+      return *context_;
+    }
+
+   private:
+    std::shared_ptr<Context> context_;
+  };
+
+  /**
+   * Constructor for context on EventLoop that outlives this Context,
+   * for example os::EventLoop::getDefaultInstance()
+   * @param _eventLoop EventLoop that executes actions
+   */
+  explicit Context(os::EventLoop *_eventLoop)
+    : event_loop_{_eventLoop} {
+  }
+
+  /**
+   * Constructor for context that shares ownership of EventLoop
+   * @param _eventLoop EventLoop that executes actions
+   */
+  explicit Context(std::shared_ptr<os::EventLoop> _eventLoop)
+    : event_loop_{_eventLoop.get()}
+    , event_loop_owner_{std::move(_eventLoop)} {
+  }
+
+  ~Context() {
+    if (timer_) {
+      // NOTE(redra): os::Timer is used only on thread of EventLoop,
+      //  so it is stopped and released there, listener is already expired
+      std::shared_ptr<os::Timer> timer = std::move(timer_);
+      event_loop_->push([timer] {
+        timer->stop();
+      });
+    }
+  }
+
+  void push(Action _action) {
+    event_loop_->push(std::move(_action));
+  }
+
+  void invoke(Action _action) {
+    if (event_loop_->getThreadId() == std::this_thread::get_id()) {
+      _action();
+    } else {
+      push(std::move(_action));
+    }
+  }
+
+  /**
+   * Pushes action that is executed once at _timePoint
+   * @param _timePoint Time point of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) {
+    return addTimer(std::move(_action), _timePoint, TimerClock::duration::zero());
+  }
+
+  TimerHandle pushAfter(TimerClock::duration _delay, Action _action) {
+    return pushAt(TimerClock::now() + _delay, std::move(_action));
+  }
+
+  /**
+   * Pushes action that is executed every _period until it is cancelled
+   * @param _period Period of action
+   * @param _action Action to push
+   * @return Handle used to cancel action
+   */
+  TimerHandle pushEvery(TimerClock::duration _period, Action _action) {
+    return addTimer(std::move(_action), TimerClock::now() + _period, _period);
+  }
+
+  /**
+   * Runs EventLoop on the current thread.
+   * With ExecPolicy::UntilWorkers EventLoop is stopped
+   * when the last Channel is destroyed
+   * @param _policy Policy of execution
+   */
+  void run(ExecPolicy _policy = ExecPolicy::Forever) override {
+    bool stopState = false;
+    if (run_.compare_exchange_strong(stopState, true)) {
+      policy_.store(_policy, std::memory_order_release);
+      if (ExecPolicy::UntilWorkers == _policy &&
+          0 == num_of_channels_.load(std::memory_order_acquire)) {
+        run_.store(false, std::memory_order_release);
+        return;
+      }
+      event_loop_->run();
+      run_.store(false, std::memory_order_release);
+    }
+  }
+
+  void stop() override {
+    // NOTE(redra): EventLoop could be stopped only after it started,
+    //  so stop is delivered through the loop itself
+    os::EventLoop *eventLoop = event_loop_;
+    event_loop_->push([eventLoop] {
+      eventLoop->stop();
+    });
+  }
+
+  std::thread::id getThreadId() const override {
+    return event_loop_->getThreadId();
+  }
+
+  bool isRun() const override {
+    return run_.load(std::memory_order_acquire);
+  }
+
+  std::unique_ptr<IChannel> createChannel() override {
+    return std::unique_ptr<Channel>(new Channel{shared_from_this()});
+  }
+
+ private:
+  /**
+   * Action that adds timer and rearms os::Timer on thread of EventLoop
+   */
+  class AddTimerAction {
+   public:
+    AddTimerAction(std::shared_ptr<Context> _context,
+                   helpers::ContextTimers::AddTimerAction _add)
+      : context_(std::move(_context))
+      , add_(std::move(_add)) {
+    }
+
+    void operator()() {
+      add_();
+      context_->armTimer();
+    }
+
+   private:
+    std::shared_ptr<Context> context_;
+    helpers::ContextTimers::AddTimerAction add_;
+  };
+
+  /**
+   * Listener of os::Timer that does not keep Context alive,
+   * os::Timer holds it by weak_ptr and Context owns it
+   */
+  class TimerListener : public os::ITimerListener {
+   public:
+    explicit TimerListener(std::weak_ptr<Context> _context)
+      : context_(std::move(_context)) {
+    }
+
+    void onTimerExpired() override {
+      if (auto context = context_.lock()) {
+        context->executeTimers();
+      }
+    }
+
+   private:
+    std::weak_ptr<Context> context_;
+  };
+
+  TimerHandle addTimer(Action _action, TimerClock::time_point _timePoint,
+                       TimerClock::duration _period) {
+    TimerHandle handle = TimerHandle::create();
+    if (event_loop_->getThreadId() == std::this_thread::get_id()) {
+      timers_.add(std::move(_action), _timePoint, _period, handle);
+      armTimer();
+    } else {
+      // NOTE(redra): Timers are owned by thread of EventLoop, so timer is added through it
+      push(AddTimerAction{shared_from_this(), helpers::ContextTimers::AddTimerAction{
+          timers_, std::move(_action), _timePoint, _period, handle}});
+    }
+    return handle;
+  }
+
+  /**
+   * Arms os::Timer for the next timer of context,
+   * should be called only from thread of EventLoop
+   */
+  void armTimer() {
+    const TimerClock::time_point kNextTimer = timers_.nextTimePoint();
+    if (kNextTimer == TimerClock::time_point::max()) {
+      if (timer_) {
+        timer_->stop();
+      }
+      return;
+    }
+    if (!timer_) {
+      timer_ = event_loop_->createTimer();
+      timer_listener_ = std::make_shared<TimerListener>(shared_from_this());
+      timer_->addListener(timer_listener_);
+    }
+    // NOTE(redra): Zero interval disarms os::Timer, so expired timer is armed for minimal interval
+    const std::chrono::nanoseconds kInterval = std::max(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(kNextTimer - TimerClock::now()),
+        std::chrono::nanoseconds(1));
+    timer_->stop();
+    timer_->setInterval(kInterval);
+    timer_->start();
+  }
+
+  void executeTimers() {
+    timers_.executeExpired();
+    armTimer();
+  }
+
+  void onLastChannelDestroyed() {
+    if (ExecPolicy::UntilWorkers == policy_.load(std::memory_order_acquire)) {
+      stop();
+    }
+  }
+
+  os::EventLoop *event_loop_ = nullptr;
+  std::shared_ptr<os::EventLoop> event_loop_owner_;
+  std::atomic<bool> run_{false};
+  std::atomic<ExecPolicy> policy_{ExecPolicy::Forever};
+  std::atomic<uint32_t> num_of_channels_{0};
+  helpers::ContextTimers timers_;
+  std::shared_ptr<os::Timer> timer_;
+  std::shared_ptr<TimerListener> timer_listener_;
+};
+
+using EventLoopContext = Context<os::EventLoop>;
+
+}
+
+#endif //ICC_OS_EVENTLOOPCONTEXT_HPP
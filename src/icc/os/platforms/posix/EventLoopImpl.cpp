@@ -195,25 +195,29 @@ bool EventLoop::EventLoopImpl::isRun() const {
 }
 
 void EventLoop::EventLoopImpl::run() {
-  event_loop_handle_.fd_ = ::eventfd(0, O_NONBLOCK);
-  if (event_loop_handle_.fd_ == -1) {
+  const int kEventFd = ::eventfd(0, O_NONBLOCK);
+  if (kEventFd == -1) {
     printf("Error to open ::eventfd(0, O_NONBLOCK): %s\n", ::strerror(errno));
     throw OSError("Error to open ::eventfd(0, O_NONBLOCK) !!");
   }
   execute_.store(true, std::memory_order_release);
+  loop_thread_id_.store(std::this_thread::get_id(), std::memory_order_release);
   {
     std::lock_guard<std::mutex> lock(internal_mtx_);
-    addFdTo(lock, read_listeners_, add_read_listeners_);
-    addFdTo(lock, write_listeners_, add_write_listeners_);
-    addFdTo(lock, error_listeners_, add_error_listeners_);
-    removeFdFrom(lock, read_listeners_, remove_read_listeners_);
-    removeFdFrom(lock, write_listeners_, remove_write_listeners_);
-    removeFdFrom(lock, error_listeners_, remove_error_listeners_);
+    event_loop_handle_.fd_ = kEventFd;
+    applyListenersChanges(lock);
+    if (!pending_actions_.empty()) {
+      // NOTE(redra): Actions pushed before run are executed in the first iteration
+      eventfd_write(event_loop_handle_.fd_, 1);
+    }
   }
   while (execute_.load(std::memory_order_acquire)) {
     fd_set readFds;
     fd_set writeFds;
     fd_set errorFds;
+    FD_ZERO(&readFds);
+    FD_ZERO(&writeFds);
+    FD_ZERO(&errorFds);
 
     int maxFd = 0;
     maxFd = std::max(maxFd, event_loop_handle_.fd_);
@@ -233,6 +237,7 @@ void EventLoop::EventLoopImpl::run() {
     handleHandlesEvents(write_listeners_, writeFds);
     handleHandlesEvents(error_listeners_, errorFds);
   }
+  loop_thread_id_.store(std::thread::id(), std::memory_order_release);
 }
 
 void EventLoop::EventLoopImpl::stop() {
@@ -242,6 +247,20 @@ void EventLoop::EventLoopImpl::stop() {
   }
 }
 
+void EventLoop::EventLoopImpl::push(Action _action) {
+  std::lock_guard<std::mutex> lock(internal_mtx_);
+  pending_actions_.push_back(std::move(_action));
+  // NOTE(redra): Loop is woken up only by the first action of batch,
+  //  the rest of actions are drained in the same iteration
+  if (pending_actions_.size() == 1 && event_loop_handle_ != kInvalidHandle) {
+    eventfd_write(event_loop_handle_.fd_, 1);
+  }
+}
+
+std::thread::id EventLoop::EventLoopImpl::getThreadId() const {
+  return loop_thread_id_.load(std::memory_order_acquire);
+}
+
 void EventLoop::EventLoopImpl::registerObjectEvents(
     const Handle & osObject,
     const long eventType,
@@ -313,7 +332,7 @@ void EventLoop::EventLoopImpl::removeFdFrom(std::lock_guard<std::mutex> &lock,
       auto foundFd = findOSObjectIn(fdInfo.object_, listeners);
       if (foundFd != listeners.end()) {
         auto itemToRemove = std::remove(foundFd->callbacks_.begin(), foundFd->callbacks_.end(), fdInfo.callback_);
-        foundFd->callbacks_.erase(itemToRemove);
+        foundFd->callbacks_.erase(itemToRemove, foundFd->callbacks_.end());
         if (foundFd->callbacks_.empty()) {
           listeners.erase(foundFd);
         }
@@ -333,19 +352,35 @@ void EventLoop::EventLoopImpl::initFds(std::vector<HandleListeners> &fds,
   }
 }
 
+void EventLoop::EventLoopImpl::applyListenersChanges(std::lock_guard<std::mutex> &lock) {
+  addFdTo(lock, read_listeners_, add_read_listeners_);
+  addFdTo(lock, write_listeners_, add_write_listeners_);
+  addFdTo(lock, error_listeners_, add_error_listeners_);
+  removeFdFrom(lock, read_listeners_, remove_read_listeners_);
+  removeFdFrom(lock, write_listeners_, remove_write_listeners_);
+  removeFdFrom(lock, error_listeners_, remove_error_listeners_);
+  add_read_listeners_.clear();
+  add_write_listeners_.clear();
+  add_error_listeners_.clear();
+  remove_read_listeners_.clear();
+  remove_write_listeners_.clear();
+  remove_error_listeners_.clear();
+}
+
 void EventLoop::EventLoopImpl::handleLoopEvents(fd_set fdSet) {
   if (FD_ISSET(event_loop_handle_.fd_, &fdSet)) {
-    std::lock_guard<std::mutex> lock(internal_mtx_);
-    eventfd_t updatedEvent;
-    eventfd_read(event_loop_handle_.fd_, &updatedEvent);
-    if (updatedEvent > 0) {
-      addFdTo(lock, read_listeners_, add_read_listeners_);
-      addFdTo(lock, write_listeners_, add_write_listeners_);
-      addFdTo(lock, error_listeners_, add_error_listeners_);
-      removeFdFrom(lock, read_listeners_, remove_read_listeners_);
-      removeFdFrom(lock, write_listeners_, remove_write_listeners_);
-      removeFdFrom(lock, error_listeners_, remove_error_listeners_);
-      eventfd_write(event_loop_handle_.fd_, 0);
+    std::vector<Action> actions;
+    {
+      std::lock_guard<std::mutex> lock(internal_mtx_);
+      eventfd_t updatedEvent;
+      eventfd_read(event_loop_handle_.fd_, &updatedEvent);
+      applyListenersChanges(lock);
+      actions.swap(pending_actions_);
+    }
+    for (auto &action : actions) {
+      if (action) {
+        action();
+      }
     }
   }
 }
@@ -32,6 +32,9 @@ class EventLoop::EventLoopImpl : public IEventLoop {
   void stop() override;
   bool isRun() const override;
 
+  void push(Action _action);
+  std::thread::id getThreadId() const;
+
   std::shared_ptr<Timer::TimerImpl> createTimerImpl();
   std::shared_ptr<ServerSocket::ServerSocketImpl> createServerSocketImpl(std::string _address, uint16_t _port, uint16_t _numQueue);
   std::shared_ptr<ServerSocket::ServerSocketImpl> createServerSocketImpl(const Handle & _socketHandle);
@@ -56,6 +59,7 @@ class EventLoop::EventLoopImpl : public IEventLoop {
   void removeFdFrom(std::lock_guard<std::mutex>& lock,
                     std::vector<HandleListeners>& listeners,
                     const std::vector<InternalEvent>& removeListeners);
+  void applyListenersChanges(std::lock_guard<std::mutex>& lock);
   void initFds(std::vector<HandleListeners> &fds, fd_set &fdSet, int &maxFd) const;
   void handleLoopEvents(fd_set fdSet);
   void handleHandlesEvents(std::vector<HandleListeners> &fds, fd_set &fdSet);
@@ -65,6 +69,8 @@ class EventLoop::EventLoopImpl : public IEventLoop {
   std::atomic<bool> execute_{true};
   std::thread event_loop_thread_;
   std::mutex internal_mtx_;
+  std::atomic<std::thread::id> loop_thread_id_;
+  std::vector<Action> pending_actions_;
   Handle event_loop_handle_{kInvalidHandle};
   std::vector<InternalEvent> add_read_listeners_;
   std::vector<InternalEvent> remove_read_listeners_;
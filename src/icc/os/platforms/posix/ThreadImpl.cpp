@@ -0,0 +1,86 @@
+/**
+ * @file ThreadImpl.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains POSIX implementation of helpers for tuning of current thread
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include <icc/os/thread/Thread.hpp>
+
+namespace icc {
+
+namespace os {
+
+bool setCurrentThreadAffinity(const unsigned _core) {
+#if defined(__linux__)
+  if (_core >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(_core, &cpuSet);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+  // NOTE(redra): MacOS does not support pinning of thread to core
+  return false;
+#endif
+}
+
+bool setCurrentThreadName(const std::string &_name) {
+#if defined(__linux__)
+  // NOTE(redra): Linux limits name of thread to 16 characters including '\0'
+  char name[16] = {};
+  strncpy(name, _name.c_str(), sizeof(name) - 1);
+  return pthread_setname_np(pthread_self(), name) == 0;
+#elif defined(__APPLE__)
+  return pthread_setname_np(_name.c_str()) == 0;
+#else
+  return false;
+#endif
+}
+
+bool setCurrentThreadSchedPolicy(const SchedPolicy _policy, const int _priority) {
+  int policy = SCHED_OTHER;
+  switch (_policy) {
+    case SchedPolicy::Default:
+      policy = SCHED_OTHER;
+      break;
+    case SchedPolicy::Fifo:
+      policy = SCHED_FIFO;
+      break;
+    case SchedPolicy::RoundRobin:
+      policy = SCHED_RR;
+      break;
+    case SchedPolicy::Batch:
+#if defined(SCHED_BATCH)
+      policy = SCHED_BATCH;
+      break;
+#else
+      return false;
+#endif
+    case SchedPolicy::Idle:
+#if defined(SCHED_IDLE)
+      policy = SCHED_IDLE;
+      break;
+#else
+      return false;
+#endif
+  }
+  sched_param param{};
+  if (policy == SCHED_FIFO || policy == SCHED_RR) {
+    param.sched_priority = _priority;
+  }
+  return pthread_setschedparam(pthread_self(), policy, &param) == 0;
+}
+
+}
+
+}
@@ -220,10 +220,16 @@ void EventLoop::EventLoopImpl::run() {
     throw OSError("Error to create CreateEvent(...) !!");
   }
   execute_.store(true, std::memory_order_release);
+  loop_thread_id_.store(std::this_thread::get_id(), std::memory_order_release);
   {
     std::lock_guard<std::mutex> lock(internal_mtx_);
     addFdTo(lock, event_listeners_, add_event_listeners_);
     removeFdFrom(lock, event_listeners_, remove_event_listeners_);
+    if (!pending_actions_.empty()) {
+      // NOTE(redra): Actions pushed before run are executed in the first iteration
+      event_loop_.store(true, std::memory_order_release);
+      ::SetEvent(event_loop_handle_.handle_);
+    }
   }
 
   WSAEVENT eventArray[WSA_MAXIMUM_WAIT_EVENTS];
@@ -240,9 +246,25 @@ void EventLoop::EventLoopImpl::run() {
     handleHandlesEvents(event_listeners_, eventArray[event - WSA_WAIT_EVENT_0]);
     handleLoopEvents();
   }
+  loop_thread_id_.store(std::thread::id(), std::memory_order_release);
   ::WSACloseEvent(event_loop_handle_.handle_);
 }
 
+void EventLoop::EventLoopImpl::push(Action _action) {
+  std::lock_guard<std::mutex> lock(internal_mtx_);
+  pending_actions_.push_back(std::move(_action));
+  // NOTE(redra): Loop is woken up only by the first action of batch,
+  //  the rest of actions are drained in the same iteration
+  if (pending_actions_.size() == 1 && event_loop_handle_ != kInvalidHandle) {
+    event_loop_.store(true, std::memory_order_release);
+    ::SetEvent(event_loop_handle_.handle_);
+  }
+}
+
+std::thread::id EventLoop::EventLoopImpl::getThreadId() const {
+  return loop_thread_id_.load(std::memory_order_acquire);
+}
+
 void EventLoop::EventLoopImpl::stop() {
   if (event_loop_handle_ != kInvalidHandle) {
     execute_.store(false, std::memory_order_release);
@@ -309,7 +331,7 @@ void EventLoop::EventLoopImpl::removeFdFrom(std::lock_guard<std::mutex> &lock,
       auto foundFd = findOSObjectIn(fdInfo.object_, listeners);
       if (foundFd != listeners.end()) {
         auto itemToRemove = std::remove(foundFd->callbacks_.begin(), foundFd->callbacks_.end(), fdInfo.callback_);
-        foundFd->callbacks_.erase(itemToRemove);
+        foundFd->callbacks_.erase(itemToRemove, foundFd->callbacks_.end());
         if (foundFd->callbacks_.empty()) {
           listeners.erase(foundFd);
         }
@@ -333,13 +355,22 @@ void EventLoop::EventLoopImpl::initFds(std::vector<HandleListeners> &fds,
 void EventLoop::EventLoopImpl::handleLoopEvents() {
   if (event_loop_.load(std::memory_order_acquire))
   {
-    std::lock_guard<std::mutex> lock(internal_mtx_);
-    event_loop_.store(false, std::memory_order_release);
-    ::ResetEvent(event_loop_handle_.handle_);
-    addFdTo(lock, event_listeners_, add_event_listeners_);
-    removeFdFrom(lock, event_listeners_, remove_event_listeners_);
-    add_event_listeners_.clear();
-    remove_event_listeners_.clear();
+    std::vector<Action> actions;
+    {
+      std::lock_guard<std::mutex> lock(internal_mtx_);
+      event_loop_.store(false, std::memory_order_release);
+      ::ResetEvent(event_loop_handle_.handle_);
+      addFdTo(lock, event_listeners_, add_event_listeners_);
+      removeFdFrom(lock, event_listeners_, remove_event_listeners_);
+      add_event_listeners_.clear();
+      remove_event_listeners_.clear();
+      actions.swap(pending_actions_);
+    }
+    for (auto &action : actions) {
+      if (action) {
+        action();
+      }
+    }
   }
 }
 
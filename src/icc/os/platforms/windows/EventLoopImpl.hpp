@@ -26,6 +26,9 @@ class EventLoop::EventLoopImpl : public IEventLoop {
   void stop() override;
   bool isRun() const override;
 
+  void push(Action _action);
+  std::thread::id getThreadId() const;
+
   std::shared_ptr<Timer::TimerImpl> createTimerImpl();
   std::shared_ptr<ServerSocket::ServerSocketImpl> createServerSocketImpl(std::string _address, uint16_t _port, uint16_t _numQueue);
   std::shared_ptr<ServerSocket::ServerSocketImpl> createServerSocketImpl(const Handle & _socketHandle);
@@ -63,6 +66,8 @@ class EventLoop::EventLoopImpl : public IEventLoop {
   WSADATA wsa_data_;
   std::thread event_loop_thread_;
   std::mutex internal_mtx_;
+  std::atomic<std::thread::id> loop_thread_id_;
+  std::vector<Action> pending_actions_;
   Handle event_loop_handle_{kInvalidHandle};
   std::atomic<bool> event_loop_{false};
   std::vector<InternalEvent> add_event_listeners_;
@@ -0,0 +1,58 @@
+/**
+ * @file ThreadImpl.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains Windows implementation of helpers for tuning of current thread
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <windows.h>
+
+#include <icc/os/thread/Thread.hpp>
+
+namespace icc {
+
+namespace os {
+
+bool setCurrentThreadAffinity(const unsigned _core) {
+  if (_core >= sizeof(DWORD_PTR) * 8) {
+    return false;
+  }
+  const DWORD_PTR kMask = static_cast<DWORD_PTR>(1) << _core;
+  return SetThreadAffinityMask(GetCurrentThread(), kMask) != 0;
+}
+
+bool setCurrentThreadName(const std::string &_name) {
+  const int kSize = MultiByteToWideChar(CP_UTF8, 0, _name.c_str(), -1, nullptr, 0);
+  if (kSize <= 0) {
+    return false;
+  }
+  std::wstring name(static_cast<std::size_t>(kSize), L'\0');
+  MultiByteToWideChar(CP_UTF8, 0, _name.c_str(), -1, &name[0], kSize);
+  return SUCCEEDED(SetThreadDescription(GetCurrentThread(), name.c_str()));
+}
+
+bool setCurrentThreadSchedPolicy(const SchedPolicy _policy, const int _priority) {
+  // NOTE(redra): Windows has no scheduling policies, so they are mapped on priorities
+  int priority = THREAD_PRIORITY_NORMAL;
+  switch (_policy) {
+    case SchedPolicy::Default:
+      priority = THREAD_PRIORITY_NORMAL;
+      break;
+    case SchedPolicy::Fifo:
+    case SchedPolicy::RoundRobin:
+      priority = THREAD_PRIORITY_TIME_CRITICAL;
+      break;
+    case SchedPolicy::Batch:
+      priority = THREAD_PRIORITY_BELOW_NORMAL;
+      break;
+    case SchedPolicy::Idle:
+      priority = THREAD_PRIORITY_IDLE;
+      break;
+  }
+  return SetThreadPriority(GetCurrentThread(), priority) != 0;
+}
+
+}
+
+}
@@ -0,0 +1,71 @@
+/**
+ * @file Thread.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains OS specific helpers for tuning of current thread:
+ * CPU affinity, name and scheduling policy
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_OS_THREAD_THREAD_HPP
+#define ICC_OS_THREAD_THREAD_HPP
+
+#include <string>
+
+#include <icc/_private/api.hpp>
+
+namespace icc {
+
+namespace os {
+
+enum class SchedPolicy {
+  /**
+   * Default time sharing policy of OS
+   */
+  Default,
+  /**
+   * Real time first in first out policy
+   */
+  Fifo,
+  /**
+   * Real time round robin policy
+   */
+  RoundRobin,
+  /**
+   * Policy for CPU intensive background threads
+   */
+  Batch,
+  /**
+   * Policy for threads that should run only when CPU is idle
+   */
+  Idle,
+};
+
+/**
+ * Pins current thread to CPU core
+ * @param _core Index of CPU core
+ * @return true if thread is pinned, false if it is not supported or failed
+ */
+ICC_PUBLIC bool setCurrentThreadAffinity(unsigned _core);
+
+/**
+ * Sets name of current thread visible in debuggers and profilers.
+ * Name could be truncated by OS
+ * @param _name Name of thread
+ * @return true if name is set, false if it is not supported or failed
+ */
+ICC_PUBLIC bool setCurrentThreadName(const std::string &_name);
+
+/**
+ * Sets scheduling policy of current thread
+ * @param _policy Scheduling policy
+ * @param _priority Priority of thread for real time policies
+ * @return true if policy is set, false if it is not supported or failed
+ */
+ICC_PUBLIC bool setCurrentThreadSchedPolicy(SchedPolicy _policy, int _priority = 0);
+
+}
+
+}
+
+#endif //ICC_OS_THREAD_THREAD_HPP
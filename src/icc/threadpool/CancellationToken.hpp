@@ -0,0 +1,95 @@
+/**
+ * @file CancellationToken.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains CancellationSource and CancellationToken classes.
+ * Source requests cancellation, tokens are checked by ThreadPool before
+ * queued task is executed and could be polled by long running tasks
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_TREADPOOL_CANCELLATIONTOKEN_HPP
+#define ICC_TREADPOOL_CANCELLATIONTOKEN_HPP
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "exceptions/TaskCancelled.hpp"
+
+namespace icc {
+
+namespace threadpool {
+
+class CancellationSource;
+
+/**
+ * Read only view of cancellation state, copies share the same state.
+ * Default constructed token is never cancelled
+ */
+class CancellationToken {
+ public:
+  CancellationToken() = default;
+
+  bool isCancelled() const {
+    return cancelled_ && cancelled_->load(std::memory_order_acquire);
+  }
+
+  /**
+   * Used by long running tasks for cooperative cancellation
+   * @throw TaskCancelled if cancellation is requested
+   */
+  void throwIfCancelled() const {
+    if (isCancelled()) {
+      throw icc::threadpool::TaskCancelled("Task is cancelled !!");
+    }
+  }
+
+  /**
+   * @return true if token could be cancelled
+   */
+  explicit operator bool() const {
+    return static_cast<bool>(cancelled_);
+  }
+
+ private:
+  friend class CancellationSource;
+
+  explicit CancellationToken(std::shared_ptr<std::atomic<bool>> _cancelled)
+    : cancelled_{std::move(_cancelled)} {
+  }
+
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+class CancellationSource {
+ public:
+  CancellationSource()
+    : cancelled_{std::make_shared<std::atomic<bool>>(false)} {
+  }
+
+  /**
+   * Requests cancellation of all tasks with tokens of this source,
+   * could be called from any thread
+   */
+  void cancel() const {
+    cancelled_->store(true, std::memory_order_release);
+  }
+
+  bool isCancelled() const {
+    return cancelled_->load(std::memory_order_acquire);
+  }
+
+  CancellationToken token() const {
+    return CancellationToken{cancelled_};
+  }
+
+ private:
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+}
+
+}
+
+#endif //ICC_TREADPOOL_CANCELLATIONTOKEN_HPP
@@ -0,0 +1,160 @@
+/**
+ * @file Parallel.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains parallel algorithms that run on ThreadPool:
+ * parallelFor, parallelTransform, parallelReduce and parallelSort.
+ * Range is split on chunks, calling thread executes chunks together with
+ * threads of ThreadPool instead of blocking
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_THREADPOOL_PARALLEL_HPP
+#define ICC_THREADPOOL_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include <icc/_private/helpers/parallel_helpers.hpp>
+#include "ThreadPool.hpp"
+
+namespace icc {
+
+namespace threadpool {
+
+/**
+ * Grain that is tuned from size of range and number of threads
+ */
+constexpr std::size_t kAutoGrain = 0;
+
+/**
+ * Calls _function for each index in range [_first, _last)
+ * @param _pool ThreadPool used to execute chunks
+ * @param _first First index
+ * @param _last Index after the last one
+ * @param _grain Number of indexes in one chunk, kAutoGrain means automatic grain
+ * @param _function Function with signature void(TIndex)
+ */
+template <typename TIndex, typename TFunction>
+void parallelFor(ThreadPool &_pool, const TIndex _first, const TIndex _last,
+                 const std::size_t _grain, TFunction _function) {
+  if (!(_first < _last)) {
+    return;
+  }
+  const std::size_t kSize = static_cast<std::size_t>(_last - _first);
+  icc::helpers::ChunkedLoop::run(_pool, kSize, _grain,
+  [_first, &_function](std::size_t _begin, std::size_t _end, std::size_t) {
+    for (std::size_t i = _begin; i < _end; ++i) {
+      _function(static_cast<TIndex>(_first + static_cast<TIndex>(i)));
+    }
+  });
+}
+
+template <typename TIndex, typename TFunction>
+void parallelFor(ThreadPool &_pool, const TIndex _first, const TIndex _last,
+                 TFunction _function) {
+  parallelFor(_pool, _first, _last, kAutoGrain, std::move(_function));
+}
+
+/**
+ * Parallel version of std::transform for random access iterators
+ * @return Iterator after the last written element
+ */
+template <typename TInputIt, typename TOutputIt, typename TUnaryOperation>
+TOutputIt parallelTransform(ThreadPool &_pool, TInputIt _first, TInputIt _last,
+                            TOutputIt _dFirst, TUnaryOperation _operation,
+                            const std::size_t _grain = kAutoGrain) {
+  const std::size_t kSize = static_cast<std::size_t>(std::distance(_first, _last));
+  icc::helpers::ChunkedLoop::run(_pool, kSize, _grain,
+  [_first, _dFirst, &_operation](std::size_t _begin, std::size_t _end, std::size_t) {
+    std::transform(_first + _begin, _first + _end, _dFirst + _begin, _operation);
+  });
+  return _dFirst + kSize;
+}
+
+/**
+ * Reduces range [_first, _last) with associative _operation.
+ * Chunks are reduced in parallel, partial results are combined in order of chunks,
+ * so result does not depend on scheduling
+ * @param _identity Identity element of _operation, initial value of each chunk
+ * @param _operation Associative function with signature T(T, value)
+ * @return Reduced value
+ */
+template <typename TIterator, typename T, typename TBinaryOperation>
+T parallelReduce(ThreadPool &_pool, TIterator _first, TIterator _last,
+                 T _identity, TBinaryOperation _operation,
+                 const std::size_t _grain = kAutoGrain) {
+  const std::size_t kSize = static_cast<std::size_t>(std::distance(_first, _last));
+  if (kSize == 0) {
+    return _identity;
+  }
+  const std::size_t kGrain = _grain != kAutoGrain
+                             ? _grain
+                             : icc::helpers::ChunkedLoop::autoGrain(kSize, _pool.size() + 1);
+  std::vector<T> partials((kSize + kGrain - 1) / kGrain, _identity);
+  icc::helpers::ChunkedLoop::run(_pool, kSize, kGrain,
+  [_first, &partials, &_operation](std::size_t _begin, std::size_t _end, std::size_t _chunkIdx) {
+    T partial = partials[_chunkIdx];
+    for (std::size_t i = _begin; i < _end; ++i) {
+      partial = _operation(partial, *(_first + i));
+    }
+    partials[_chunkIdx] = partial;
+  });
+  T result = _identity;
+  for (const auto &partial : partials) {
+    result = _operation(result, partial);
+  }
+  return result;
+}
+
+/**
+ * Sorts range [_first, _last) of random access iterators.
+ * Chunks are sorted in parallel, then sorted chunks are merged
+ * pairwise in parallel rounds
+ * @param _grain Minimal number of elements in one chunk, kAutoGrain means automatic grain
+ */
+template <typename TIterator, typename TCompare>
+void parallelSort(ThreadPool &_pool, TIterator _first, TIterator _last,
+                  TCompare _compare, const std::size_t _grain = kAutoGrain) {
+  const std::size_t kSize = static_cast<std::size_t>(std::distance(_first, _last));
+  const std::size_t kNumThreads = _pool.size() + 1;
+  // NOTE(redra): Each merge round halves parallelism,
+  //  so sort uses one chunk per thread instead of many small chunks
+  const std::size_t kGrain = std::max<std::size_t>(
+      _grain, (kSize + kNumThreads - 1) / kNumThreads);
+  if (kSize < 2 || kGrain >= kSize) {
+    std::sort(_first, _last, _compare);
+    return;
+  }
+  icc::helpers::ChunkedLoop::run(_pool, kSize, kGrain,
+  [_first, &_compare](std::size_t _begin, std::size_t _end, std::size_t) {
+    std::sort(_first + _begin, _first + _end, _compare);
+  });
+  for (std::size_t width = kGrain; width < kSize; width *= 2) {
+    const std::size_t kNumMerges = (kSize + 2 * width - 1) / (2 * width);
+    icc::helpers::ChunkedLoop::run(_pool, kNumMerges, 1,
+    [_first, kSize, width, &_compare](std::size_t _begin, std::size_t, std::size_t) {
+      const std::size_t kLeft = _begin * 2 * width;
+      const std::size_t kMiddle = std::min(kSize, kLeft + width);
+      const std::size_t kRight = std::min(kSize, kLeft + 2 * width);
+      if (kMiddle < kRight) {
+        std::inplace_merge(_first + kLeft, _first + kMiddle, _first + kRight, _compare);
+      }
+    });
+  }
+}
+
+template <typename TIterator>
+void parallelSort(ThreadPool &_pool, TIterator _first, TIterator _last) {
+  using ValueType = typename std::iterator_traits<TIterator>::value_type;
+  parallelSort(_pool, _first, _last, std::less<ValueType>());
+}
+
+}
+
+}
+
+#endif //ICC_THREADPOOL_PARALLEL_HPP
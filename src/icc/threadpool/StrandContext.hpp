@@ -0,0 +1,303 @@
+/**
+ * @file StrandContext.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains Context<ThreadPool>, also known as StrandContext.
+ * It is implementation of IContext interface that has no own thread.
+ * Pending actions are executed serially as one task on ThreadPool,
+ * task yields back to ThreadPool after batch of actions. It allows to run
+ * many mostly idle Components on a fixed number of threads
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_THREADPOOL_STRANDCONTEXT_HPP
+#define ICC_THREADPOOL_STRANDCONTEXT_HPP
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <icc/Context.hpp>
+#include "ThreadPool.hpp"
+
+namespace icc {
+
+template <>
+class Context<threadpool::ThreadPool> final
+    : public IContext
+    , public std::enable_shared_from_this<Context<threadpool::ThreadPool>> {
+ public:
+  /**
+   * Default number of actions executed before task yields back to ThreadPool
+   */
+  static constexpr std::size_t kDefaultMaxBatchSize = 64;
+
+  class Channel : public IContext::IChannel {
+   public:
+    using IContext::IChannel::push;
+
+    explicit Channel(std::shared_ptr<Context> context)
+      : context_{std::move(context)} {
+    }
+
+    void push(Action _action) override {
+      if (context_) {
+        context_->push(std::move(_action));
+      }
+    }
+
+    void invoke(Action _action) override {
+      if (context_) {
+        context_->invoke(std::move(_action));
+      }
+    }
+
+    void push(Action _action, Priority _priority) override {
+      if (context_) {
+        context_->push(std::move(_action), _priority);
+      }
+    }
+
+    void invoke(Action _action, Priority _priority) override {
+      if (context_) {
+        context_->invoke(std::move(_action), _priority);
+      }
+    }
+
+    void pushBatch(std::vector<Action> _actions) override {
+      if (context_) {
+        context_->pushBatch(std::move(_actions));
+      }
+    }
+
+    TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) override {
+      if (context_) {
+        return context_->pushAt(_timePoint, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+    TimerHandle pushEvery(TimerClock::duration _period, Action _action) override {
+      if (context_) {
+        return context_->pushEvery(_period, std::move(_action));
+      }
+      return TimerHandle{};
+    }
+
+#if __cpp_lib_optional >= 201606L
+    [[nodiscard]]
+#endif
+    IContext & getContext() const override {
+      return *context_;
+    }
+
+   private:
+    std::shared_ptr<Context> context_;
+  };
+
+  /**
+   * Constructor for strand on ThreadPool that outlives this Context,
+   * for example ThreadPool::getDefaultPool()
+   * @param _pool ThreadPool that executes actions
+   */
+  explicit Context(threadpool::ThreadPool *_pool)
+    : pool_{_pool} {
+  }
+
+  /**
+   * Constructor for strand on shared ThreadPool.
+   * Context does not prolong life of ThreadPool, otherwise ThreadPool could be
+   * destroyed from its own thread. Actions pushed after destruction of
+   * ThreadPool are not executed
+   * @param _pool ThreadPool that executes actions
+   */
+  explicit Context(const std::shared_ptr<threadpool::ThreadPool> &_pool)
+    : pool_{_pool.get()}
+    , weak_pool_{_pool}
+    , is_pool_shared_{true} {
+  }
+
+  void push(Action _action, Priority _priority = Priority::Normal) {
+    queue_.push(std::move(_action), _priority);
+    schedule();
+  }
+
+  /**
+   * Pushes actions under single lock and schedules strand once
+   * @param _actions Actions to push
+   * @param _priority Priority of actions
+   */
+  void pushBatch(std::vector<Action> _actions, Priority _priority = Priority::Normal) {
+    queue_.pushBatch(_actions.begin(), _actions.end(), true, _priority);
+    schedule();
+  }
+
+  void invoke(Action _action, Priority _priority = Priority::Normal) {
+    if (executing_thread_id_.load(std::memory_order_acquire) ==
+        std::this_thread::get_id()) {
+      _action();
+    } else {
+      push(std::move(_action), _priority);
+    }
+  }
+
+  /**
+   * Pushes action that is executed once at _timePoint.
+   * Strand has no own thread, so timer is kept by scheduler of ThreadPool
+   * and action is pushed in strand when it is due
+   * @param _timePoint Time point of action
+   * @param _action Action to push
+   * @return Handle used to cancel action, empty handle if ThreadPool is destroyed
+   */
+  TimerHandle pushAt(TimerClock::time_point _timePoint, Action _action) {
+    TimerTask task{shared_from_this(), std::move(_action)};
+    std::shared_ptr<threadpool::ThreadPool> sharedPool;
+    if (threadpool::ThreadPool *pool = acquirePool(sharedPool)) {
+      return pool->scheduleAt(_timePoint, std::move(task));
+    }
+    return TimerHandle{};
+  }
+
+  TimerHandle pushAfter(TimerClock::duration _delay, Action _action) {
+    return pushAt(TimerClock::now() + _delay, std::move(_action));
+  }
+
+  /**
+   * Pushes action that is executed every _period until it is cancelled
+   * @param _period Period of action
+   * @param _action Action to push
+   * @return Handle used to cancel action, empty handle if ThreadPool is destroyed
+   */
+  TimerHandle pushEvery(TimerClock::duration _period, Action _action) {
+    TimerTask task{shared_from_this(), std::move(_action)};
+    std::shared_ptr<threadpool::ThreadPool> sharedPool;
+    if (threadpool::ThreadPool *pool = acquirePool(sharedPool)) {
+      return pool->scheduleEvery(_period, std::move(task));
+    }
+    return TimerHandle{};
+  }
+
+  /**
+   * Sets number of actions that are executed before task
+   * yields back to ThreadPool
+   * @param _maxBatchSize Maximum size of batch, 0 means all pending actions
+   */
+  void setMaxBatchSize(std::size_t _maxBatchSize) {
+    max_batch_size_.store(_maxBatchSize, std::memory_order_release);
+  }
+
+  std::unique_ptr<IChannel> createChannel() override {
+    return std::unique_ptr<Channel>(new Channel{shared_from_this()});
+  }
+
+ private:
+  /**
+   * Task of ThreadPool scheduler that pushes timer action in strand,
+   * so timer action is serialized with other actions of strand.
+   * Timer does not prolong life of strand
+   */
+  class TimerTask {
+   public:
+    TimerTask(const std::shared_ptr<Context> &_strand, Action _action)
+      : strand_(_strand)
+      , action_(std::make_shared<Action>(std::move(_action))) {
+    }
+
+    void operator()() {
+      if (auto strand = strand_.lock()) {
+        // NOTE(redra): Periodic timer pushes the same action many times, so action is shared
+        std::shared_ptr<Action> action = action_;
+        strand->push([action] {
+          if (*action) {
+            (*action)();
+          }
+        });
+      }
+    }
+
+   private:
+    std::weak_ptr<Context> strand_;
+    std::shared_ptr<Action> action_;
+  };
+
+  /**
+   * Resets state of strand after batch even if action throws exception
+   */
+  class BatchGuard {
+   public:
+    explicit BatchGuard(Context &_context)
+      : context_(_context) {
+      context_.executing_thread_id_.store(std::this_thread::get_id(), std::memory_order_release);
+    }
+
+    ~BatchGuard() {
+      context_.executing_thread_id_.store(std::thread::id(), std::memory_order_release);
+      context_.scheduled_.store(false, std::memory_order_release);
+      // NOTE(redra): Action could be pushed after the last tryPop,
+      //  but before scheduled_ is reset, so queue is checked again
+      if (!context_.queue_.empty()) {
+        context_.schedule();
+      }
+    }
+
+   private:
+    Context &context_;
+  };
+
+  void schedule() {
+    if (!scheduled_.exchange(true, std::memory_order_acq_rel)) {
+      auto self = shared_from_this();
+      Action task = [self] {
+        self->executeBatch();
+      };
+      std::shared_ptr<threadpool::ThreadPool> sharedPool;
+      if (threadpool::ThreadPool *pool = acquirePool(sharedPool)) {
+        pool->push(std::move(task));
+      } else {
+        scheduled_.store(false, std::memory_order_release);
+      }
+    }
+  }
+
+  /**
+   * Shared ThreadPool is not locked on its own thread, otherwise the thread
+   * could release the last reference and ThreadPool would join itself.
+   * ThreadPool is alive while its thread runs, so it is used without lock
+   * @param _sharedPool Keeps shared ThreadPool alive while it is used
+   * @return ThreadPool or nullptr if it is destroyed
+   */
+  threadpool::ThreadPool * acquirePool(std::shared_ptr<threadpool::ThreadPool> &_sharedPool) const {
+    if (!is_pool_shared_ || threadpool::ThreadPool::current() == pool_) {
+      return pool_;
+    }
+    _sharedPool = weak_pool_.lock();
+    return _sharedPool.get();
+  }
+
+  void executeBatch() {
+    BatchGuard guard{*this};
+    const std::size_t kMaxBatchSize = max_batch_size_.load(std::memory_order_acquire);
+    Action action;
+    for (std::size_t i = 0; (kMaxBatchSize == 0 || i < kMaxBatchSize) &&
+                            queue_.tryPop(action); ++i) {
+      if (action) {
+        action();
+      }
+      action = nullptr;
+    }
+  }
+
+  threadpool::ThreadPool *pool_ = nullptr;
+  std::weak_ptr<threadpool::ThreadPool> weak_pool_;
+  const bool is_pool_shared_ = false;
+  ThreadSafeQueueAction queue_;
+  std::atomic<bool> scheduled_{false};
+  std::atomic<std::thread::id> executing_thread_id_;
+  std::atomic<std::size_t> max_batch_size_{kDefaultMaxBatchSize};
+};
+
+using StrandContext = Context<threadpool::ThreadPool>;
+
+}
+
+#endif //ICC_THREADPOOL_STRANDCONTEXT_HPP
@@ -2,17 +2,29 @@
  * @file Task.hpp
  * @author Denis Kotov
  * @date 08 Apr 2018
- * @brief Throws when task is invalid
+ * @brief Contains Task class that is executed on ThreadPool.
+ * Copies of Task share the same task, continueWith() schedules new Task
+ * on ThreadPool when predecessor is completed, whenAll() and whenAny()
+ * join several Tasks, so DAG of Tasks is executed without blocking threads.
+ * Task with cancelled CancellationToken is completed with TaskCancelled
+ * exception instead of execution
  * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
  */
 
 #ifndef ICC_TREADPOOL_TASK_HPP
 #define ICC_TREADPOOL_TASK_HPP
 
+#include <atomic>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <icc/Component.hpp>
+#include "CancellationToken.hpp"
 #include "ThreadPool.hpp"
+#include "TaskState.hpp"
+#include "exceptions/TaskCancelled.hpp"
 #include "exceptions/TaskInvalid.hpp"
 #include "exceptions/TaskStateAssert.hpp"
 
@@ -22,37 +34,102 @@ namespace threadpool {
 
 class ThreadPool;
 
+template<typename TRes>
+class Task;
+
+template<typename TRes>
+Task<std::vector<TRes>> whenAll(std::vector<Task<TRes>> _tasks);
+Task<void> whenAll(std::vector<Task<void>> _tasks);
+template<typename TRes>
+Task<TRes> whenAny(std::vector<Task<TRes>> _tasks);
+Task<void> whenAny(std::vector<Task<void>> _tasks);
+
 template<typename TRes>
 class Task {
  public:
-  explicit Task(std::function<TRes(void)> _task) {
+  explicit Task(std::function<TRes(void)> _task)
+    : core_ptr_{std::make_shared<Core>()} {
     if (_task) {
-      task_ = _task;
+      core_ptr_->task_ = _task;
     } else {
       throw icc::threadpool::TaskInvalid("Main _task is not valid !!");
     }
   }
 
   void setDescription(const std::string & _description) {
-    description_ = _description;
+    core_ptr_->description_ = _description;
   }
 
+  /**
+   * Sets token that is checked right before execution of task,
+   * continuations created after this call inherit the token
+   * @param _token Cancellation token
+   * @return Reference to this Task
+   */
+  Task & setCancellationToken(CancellationToken _token) {
+    core_ptr_->cancellation_token_ = std::move(_token);
+    return *this;
+  }
+
+  /**
+   * Sets priority of task in queue of ThreadPool,
+   * continuations created after this call inherit the priority
+   * @param _priority Priority of task
+   * @return Reference to this Task
+   */
+  Task & setPriority(Priority _priority) {
+    core_ptr_->priority_ = _priority;
+    return *this;
+  }
+
+  /**
+   * Adds callback that is called on the same thread right after task
+   * @param _task Callback with result of task
+   * @return Reference to this Task
+   */
   Task & then(std::function<void(TRes)> _task) {
     if (_task) {
-      thens_.push_back(_task);
+      core_ptr_->thens_.push_back(_task);
     } else {
       throw icc::threadpool::TaskInvalid("_task in then is not valid !!");
     }
     return *this;
   }
 
+  /**
+   * Creates Task that is scheduled on ThreadPool when this Task is completed.
+   * Exception of this Task is forwarded to continuation without calling _function
+   * @param _function Function with signature TNextRes(const TRes &)
+   * @return Continuation Task, it is started automatically
+   */
+  template<typename TFunction>
+  auto continueWith(TFunction _function)
+      -> Task<decltype(_function(std::declval<const TRes &>()))> {
+    using TNextRes = decltype(_function(std::declval<const TRes &>()));
+    Task<TNextRes> next = Task<TNextRes>::createContinuation(
+        core_ptr_->thread_pool_ptr_, core_ptr_->cancellation_token_, core_ptr_->priority_);
+    std::weak_ptr<TaskState<TRes>> weakState = core_ptr_->state_ptr_;
+    auto nextCore = next.core_ptr_;
+    core_ptr_->state_ptr_->addContinuation([weakState, nextCore, _function](bool _isLast) {
+      // NOTE(redra): Continuation is called while this Task is alive,
+      //  continuation Task keeps its state until it is executed
+      std::shared_ptr<TaskState<TRes>> state = weakState.lock();
+      TFunction function = _function;
+      nextCore->task_ = [state, function]() mutable -> TNextRes {
+        return function(state->result());
+      };
+      Task<TNextRes>::schedule(nextCore, _isLast);
+    });
+    return next;
+  }
+
   template<typename _Component>
   Task & callback(void(_Component::*_callback)(TRes),
                   std::shared_ptr<_Component> _listener) {
     static_assert(std::is_base_of<icc::Component, _Component>::value,
                   "_listener is not derived from Component");
     std::weak_ptr<_Component> weakListener = _listener;
-    callback_ = [=] (TRes _result) {
+    core_ptr_->callback_ = [=] (TRes _result) {
       if (auto listener = weakListener.lock()) {
         auto ptrListener = listener.get();
         ptrListener->push([=] {
@@ -60,6 +137,7 @@ class Task {
         });
       }
     };
+    return *this;
   }
 
   template<typename _Component>
@@ -67,7 +145,7 @@ class Task {
                   _Component *_listener) {
     static_assert(std::is_base_of<icc::Component, _Component>::value,
                   "_listener is not derived from Component");
-    callback_ = [=] (TRes _result) {
+    core_ptr_->callback_ = [=] (TRes _result) {
       _listener->push([=] {
         (_listener->*_callback)(_result);
       });
@@ -76,31 +154,24 @@ class Task {
   }
 
   void start() {
-    if (!state_) {
-      state_ = true;
-      if (thread_pool_ptr_) {
-        thread_pool_ptr_->push(static_cast<std::function<void(void)>>(*this));
-      } else {
-        ThreadPool::getDefaultPool().push(static_cast<std::function<void(void)>>(*this));
-      }
+    bool startState = false;
+    if (core_ptr_->is_started_.compare_exchange_strong(startState, true)) {
+      schedule(core_ptr_);
     } else {
       throw icc::threadpool::TaskStateAssert("Task is already started !!");
     }
   }
 
   bool isStarted() const {
-    return state_;
+    return core_ptr_->is_started_.load(std::memory_order_acquire);
+  }
+
+  bool isCompleted() const {
+    return core_ptr_->state_ptr_->isCompleted();
   }
 
   TRes operator()() {
-    auto result = task_();
-    for (auto & then: thens_) {
-      then(result);
-    }
-    if (callback_) {
-      callback_(result);
-    }
-    return result;
+    return execute(*core_ptr_);
   }
 
   static void start(std::function<TRes(void)> _task) {
@@ -109,52 +180,189 @@ class Task {
 
  private:
   friend class ThreadPool;
+  template<typename>
+  friend class Task;
+  template<typename TAnyRes>
+  friend Task<std::vector<TAnyRes>> whenAll(std::vector<Task<TAnyRes>> _tasks);
+  template<typename TAnyRes>
+  friend Task<TAnyRes> whenAny(std::vector<Task<TAnyRes>> _tasks);
+
+  struct Core {
+    std::atomic<bool> is_started_{false};
+    bool is_continuation_ = false;
+    std::string description_;
+    std::shared_ptr<ThreadPool> thread_pool_ptr_;
+    CancellationToken cancellation_token_;
+    Priority priority_ = Priority::Normal;
+    std::function<TRes(void)> task_;
+    std::vector<std::function<void(TRes)>> thens_;
+    std::function<void(TRes)> callback_;
+    std::shared_ptr<TaskState<TRes>> state_ptr_ = std::make_shared<TaskState<TRes>>();
+  };
+
+  Task()
+    : core_ptr_{std::make_shared<Core>()} {
+  }
+
+  /**
+   * Creates Task that is started by its predecessors
+   */
+  static Task createContinuation(std::shared_ptr<ThreadPool> _threadPool,
+                                 CancellationToken _token = CancellationToken(),
+                                 const Priority _priority = Priority::Normal) {
+    Task task;
+    task.core_ptr_->thread_pool_ptr_ = std::move(_threadPool);
+    task.core_ptr_->cancellation_token_ = std::move(_token);
+    task.core_ptr_->priority_ = _priority;
+    task.core_ptr_->is_started_.store(true, std::memory_order_release);
+    task.core_ptr_->is_continuation_ = true;
+    return task;
+  }
+
+  /**
+   * Pushes task in ThreadPool. Continuation that is the last one of completed
+   * predecessor is dispatched, so it runs in place on thread of ThreadPool
+   */
+  static void schedule(const std::shared_ptr<Core> &_core, const bool _mayRunInPlace = false) {
+    std::shared_ptr<Core> core = _core;
+    Action action = [core] {
+      run(*core);
+    };
+    ThreadPool &pool = core->thread_pool_ptr_ ? *core->thread_pool_ptr_
+                                              : ThreadPool::getDefaultPool();
+    if (_mayRunInPlace) {
+      pool.dispatch(std::move(action), core->priority_);
+    } else {
+      pool.push(std::move(action), core->priority_);
+    }
+  }
+
+  /**
+   * Executes task on ThreadPool. Exception is kept in state of continuation Task
+   * or Task that has continuations, otherwise it is rethrown.
+   * Cancellation is not an error of ThreadPool and is never rethrown
+   */
+  static void run(Core &_core) {
+    try {
+      execute(_core);
+    } catch (const icc::threadpool::TaskCancelled &) {
+    } catch (...) {
+      if (!_core.is_continuation_ && !_core.state_ptr_->hasContinuations()) {
+        throw;
+      }
+    }
+  }
+
+  static TRes execute(Core &_core) {
+    try {
+      _core.cancellation_token_.throwIfCancelled();
+      auto result = _core.task_();
+      for (auto & then: _core.thens_) {
+        then(result);
+      }
+      if (_core.callback_) {
+        _core.callback_(result);
+      }
+      _core.state_ptr_->setResult(result);
+      return result;
+    } catch (...) {
+      _core.state_ptr_->setException(std::current_exception());
+      throw;
+    }
+  }
 
   Task & setThreadPool(std::shared_ptr<ThreadPool> threadPoolPtr) {
-    thread_pool_ptr_ = threadPoolPtr;
+    core_ptr_->thread_pool_ptr_ = threadPoolPtr;
     return *this;
   }
 
-  bool state_ = false;
-  std::string description_ = "";
-
-  std::shared_ptr<ThreadPool> thread_pool_ptr_;
-  std::function<TRes(void)> task_ = nullptr;
-  std::vector<std::function<void(TRes)>> thens_;
-  std::function<void(TRes)> callback_ = nullptr;
+  std::shared_ptr<Core> core_ptr_;
 };
 
 template<>
 class Task<void> {
  public:
-  explicit Task(std::function<void(void)> _task) {
+  explicit Task(std::function<void(void)> _task)
+    : core_ptr_{std::make_shared<Core>()} {
     if (_task) {
-      task_ = _task;
+      core_ptr_->task_ = _task;
     } else {
       throw icc::threadpool::TaskInvalid("Main _task is not valid !!");
     }
   }
 
   void setDescription(const std::string & _description) {
-    description_ = _description;
+    core_ptr_->description_ = _description;
   }
 
+  /**
+   * Sets token that is checked right before execution of task,
+   * continuations created after this call inherit the token
+   * @param _token Cancellation token
+   * @return Reference to this Task
+   */
+  Task & setCancellationToken(CancellationToken _token) {
+    core_ptr_->cancellation_token_ = std::move(_token);
+    return *this;
+  }
+
+  /**
+   * Sets priority of task in queue of ThreadPool,
+   * continuations created after this call inherit the priority
+   * @param _priority Priority of task
+   * @return Reference to this Task
+   */
+  Task & setPriority(Priority _priority) {
+    core_ptr_->priority_ = _priority;
+    return *this;
+  }
+
+  /**
+   * Adds callback that is called on the same thread right after task
+   * @param _task Callback
+   * @return Reference to this Task
+   */
   Task & then(std::function<void(void)> _task) {
     if (_task) {
-      thens_.push_back(_task);
+      core_ptr_->thens_.push_back(_task);
     } else {
       throw icc::threadpool::TaskInvalid("_task in then is not valid !!");
     }
     return *this;
   }
 
+  /**
+   * Creates Task that is scheduled on ThreadPool when this Task is completed.
+   * Exception of this Task is forwarded to continuation without calling _function
+   * @param _function Function with signature TNextRes()
+   * @return Continuation Task, it is started automatically
+   */
+  template<typename TFunction>
+  auto continueWith(TFunction _function) -> Task<decltype(_function())> {
+    using TNextRes = decltype(_function());
+    Task<TNextRes> next = Task<TNextRes>::createContinuation(
+        core_ptr_->thread_pool_ptr_, core_ptr_->cancellation_token_, core_ptr_->priority_);
+    std::weak_ptr<TaskState<void>> weakState = core_ptr_->state_ptr_;
+    auto nextCore = next.core_ptr_;
+    core_ptr_->state_ptr_->addContinuation([weakState, nextCore, _function](bool _isLast) {
+      std::shared_ptr<TaskState<void>> state = weakState.lock();
+      TFunction function = _function;
+      nextCore->task_ = [state, function]() mutable -> TNextRes {
+        state->result();
+        return function();
+      };
+      Task<TNextRes>::schedule(nextCore, _isLast);
+    });
+    return next;
+  }
+
   template<typename _Component>
   Task & callback(void(_Component::*_callback)(void),
                   std::shared_ptr<_Component> _listener) {
     static_assert(std::is_base_of<icc::Component, _Component>::value,
                   "_listener is not derived from Component");
     std::weak_ptr<_Component> weakListener = _listener;
-    callback_ = [=] (void) {
+    core_ptr_->callback_ = [=] (void) {
       if (auto listener = weakListener.lock()) {
         auto ptrListener = listener.get();
         ptrListener->push([=] {
@@ -170,7 +378,7 @@ class Task<void> {
                   _Component *_listener) {
     static_assert(std::is_base_of<icc::Component, _Component>::value,
                   "_listener is not derived from Component");
-    callback_ = [=] () {
+    core_ptr_->callback_ = [=] () {
       _listener->push([=] {
         (_listener->*_callback)();
       });
@@ -179,30 +387,24 @@ class Task<void> {
   }
 
   void start() {
-    if (!state_) {
-      state_ = true;
-      if (thread_pool_ptr_) {
-        thread_pool_ptr_->push(static_cast<std::function<void(void)>>(*this));
-      } else {
-        ThreadPool::getDefaultPool().push(static_cast<std::function<void(void)>>(*this));
-      }
+    bool startState = false;
+    if (core_ptr_->is_started_.compare_exchange_strong(startState, true)) {
+      schedule(core_ptr_);
     } else {
       throw icc::threadpool::TaskStateAssert("Task is already started !!");
     }
   }
 
   bool isStarted() const {
-    return state_;
+    return core_ptr_->is_started_.load(std::memory_order_acquire);
+  }
+
+  bool isCompleted() const {
+    return core_ptr_->state_ptr_->isCompleted();
   }
 
   void operator()() {
-    task_();
-    for (auto & then : thens_) {
-      then();
-    }
-    if (callback_) {
-      callback_();
-    }
+    execute(*core_ptr_);
   }
 
   static void start(std::function<void(void)> _task) {
@@ -211,21 +413,263 @@ class Task<void> {
 
  private:
   friend class ThreadPool;
+  template<typename>
+  friend class Task;
+  template<typename TAnyRes>
+  friend Task<std::vector<TAnyRes>> whenAll(std::vector<Task<TAnyRes>> _tasks);
+  friend Task<void> whenAll(std::vector<Task<void>> _tasks);
+  template<typename TAnyRes>
+  friend Task<TAnyRes> whenAny(std::vector<Task<TAnyRes>> _tasks);
+  friend Task<void> whenAny(std::vector<Task<void>> _tasks);
+
+  struct Core {
+    std::atomic<bool> is_started_{false};
+    bool is_continuation_ = false;
+    std::string description_;
+    std::shared_ptr<ThreadPool> thread_pool_ptr_;
+    CancellationToken cancellation_token_;
+    Priority priority_ = Priority::Normal;
+    std::function<void(void)> task_;
+    std::vector<std::function<void(void)>> thens_;
+    std::function<void(void)> callback_;
+    std::shared_ptr<TaskState<void>> state_ptr_ = std::make_shared<TaskState<void>>();
+  };
+
+  Task()
+    : core_ptr_{std::make_shared<Core>()} {
+  }
+
+  /**
+   * Creates Task that is started by its predecessors
+   */
+  static Task createContinuation(std::shared_ptr<ThreadPool> _threadPool,
+                                 CancellationToken _token = CancellationToken(),
+                                 const Priority _priority = Priority::Normal) {
+    Task task;
+    task.core_ptr_->thread_pool_ptr_ = std::move(_threadPool);
+    task.core_ptr_->cancellation_token_ = std::move(_token);
+    task.core_ptr_->priority_ = _priority;
+    task.core_ptr_->is_started_.store(true, std::memory_order_release);
+    task.core_ptr_->is_continuation_ = true;
+    return task;
+  }
+
+  /**
+   * Pushes task in ThreadPool. Continuation that is the last one of completed
+   * predecessor is dispatched, so it runs in place on thread of ThreadPool
+   */
+  static void schedule(const std::shared_ptr<Core> &_core, const bool _mayRunInPlace = false) {
+    std::shared_ptr<Core> core = _core;
+    Action action = [core] {
+      run(*core);
+    };
+    ThreadPool &pool = core->thread_pool_ptr_ ? *core->thread_pool_ptr_
+                                              : ThreadPool::getDefaultPool();
+    if (_mayRunInPlace) {
+      pool.dispatch(std::move(action), core->priority_);
+    } else {
+      pool.push(std::move(action), core->priority_);
+    }
+  }
+
+  /**
+   * Executes task on ThreadPool. Exception is kept in state of continuation Task
+   * or Task that has continuations, otherwise it is rethrown.
+   * Cancellation is not an error of ThreadPool and is never rethrown
+   */
+  static void run(Core &_core) {
+    try {
+      execute(_core);
+    } catch (const icc::threadpool::TaskCancelled &) {
+    } catch (...) {
+      if (!_core.is_continuation_ && !_core.state_ptr_->hasContinuations()) {
+        throw;
+      }
+    }
+  }
+
+  static void execute(Core &_core) {
+    try {
+      _core.cancellation_token_.throwIfCancelled();
+      _core.task_();
+      for (auto & then : _core.thens_) {
+        then();
+      }
+      if (_core.callback_) {
+        _core.callback_();
+      }
+      _core.state_ptr_->setResult();
+    } catch (...) {
+      _core.state_ptr_->setException(std::current_exception());
+      throw;
+    }
+  }
 
   Task & setThreadPool(std::shared_ptr<ThreadPool> threadPoolPtr) {
-    thread_pool_ptr_ = threadPoolPtr;
+    core_ptr_->thread_pool_ptr_ = threadPoolPtr;
     return *this;
   }
 
-  bool state_ = false;
-  std::string description_ = "";
-
-  std::shared_ptr<ThreadPool> thread_pool_ptr_;
-  std::function<void(void)> task_ = nullptr;
-  std::vector<std::function<void(void)>> thens_;
-  std::function<void(void)> callback_ = nullptr;
+  std::shared_ptr<Core> core_ptr_;
 };
 
+/**
+ * Creates Task that is completed when all _tasks are completed.
+ * Result of Task contains results of _tasks in the same order,
+ * if any of _tasks throws, Task rethrows the first exception
+ * @param _tasks Tasks to join, they are not started by whenAll
+ * @return Joining Task, it is started automatically
+ */
+template<typename TRes>
+Task<std::vector<TRes>> whenAll(std::vector<Task<TRes>> _tasks) {
+  struct Joint {
+    std::mutex mtx_;
+    std::vector<std::unique_ptr<TRes>> results_;
+    std::exception_ptr exception_;
+    std::size_t num_pending_;
+  };
+  using TAllRes = std::vector<TRes>;
+  Task<TAllRes> all = Task<TAllRes>::createContinuation(
+      _tasks.empty() ? nullptr : _tasks.front().core_ptr_->thread_pool_ptr_);
+  auto allCore = all.core_ptr_;
+  auto joint = std::make_shared<Joint>();
+  allCore->task_ = [joint]() -> TAllRes {
+    if (joint->exception_) {
+      std::rethrow_exception(joint->exception_);
+    }
+    TAllRes results;
+    results.reserve(joint->results_.size());
+    for (auto &result : joint->results_) {
+      results.push_back(std::move(*result));
+    }
+    return results;
+  };
+  if (_tasks.empty()) {
+    Task<TAllRes>::schedule(allCore);
+    return all;
+  }
+  joint->results_.resize(_tasks.size());
+  joint->num_pending_ = _tasks.size();
+  for (std::size_t i = 0; i < _tasks.size(); ++i) {
+    std::weak_ptr<TaskState<TRes>> weakState = _tasks[i].core_ptr_->state_ptr_;
+    _tasks[i].core_ptr_->state_ptr_->addContinuation([weakState, joint, allCore, i](bool _isLast) {
+      std::shared_ptr<TaskState<TRes>> state = weakState.lock();
+      bool isLastPending = false;
+      {
+        std::lock_guard<std::mutex> lock{joint->mtx_};
+        if (std::exception_ptr exception = state->exception()) {
+          if (!joint->exception_) {
+            joint->exception_ = exception;
+          }
+        } else {
+          joint->results_[i].reset(new TRes(state->result()));
+        }
+        isLastPending = --joint->num_pending_ == 0;
+      }
+      if (isLastPending) {
+        Task<TAllRes>::schedule(allCore, _isLast);
+      }
+    });
+  }
+  return all;
+}
+
+inline
+Task<void> whenAll(std::vector<Task<void>> _tasks) {
+  struct Joint {
+    std::mutex mtx_;
+    std::exception_ptr exception_;
+    std::size_t num_pending_;
+  };
+  Task<void> all = Task<void>::createContinuation(
+      _tasks.empty() ? nullptr : _tasks.front().core_ptr_->thread_pool_ptr_);
+  auto allCore = all.core_ptr_;
+  auto joint = std::make_shared<Joint>();
+  allCore->task_ = [joint] {
+    if (joint->exception_) {
+      std::rethrow_exception(joint->exception_);
+    }
+  };
+  if (_tasks.empty()) {
+    Task<void>::schedule(allCore);
+    return all;
+  }
+  joint->num_pending_ = _tasks.size();
+  for (auto &task : _tasks) {
+    std::weak_ptr<TaskState<void>> weakState = task.core_ptr_->state_ptr_;
+    task.core_ptr_->state_ptr_->addContinuation([weakState, joint, allCore](bool _isLast) {
+      std::shared_ptr<TaskState<void>> state = weakState.lock();
+      bool isLastPending = false;
+      {
+        std::lock_guard<std::mutex> lock{joint->mtx_};
+        std::exception_ptr exception = state->exception();
+        if (exception && !joint->exception_) {
+          joint->exception_ = exception;
+        }
+        isLastPending = --joint->num_pending_ == 0;
+      }
+      if (isLastPending) {
+        Task<void>::schedule(allCore, _isLast);
+      }
+    });
+  }
+  return all;
+}
+
+/**
+ * Creates Task that is completed when the first of _tasks is completed
+ * with its result or exception
+ * @param _tasks Tasks to wait, they are not started by whenAny
+ * @return Task with the first result, it is started automatically
+ */
+template<typename TRes>
+Task<TRes> whenAny(std::vector<Task<TRes>> _tasks) {
+  if (_tasks.empty()) {
+    throw icc::threadpool::TaskInvalid("_tasks in whenAny are empty !!");
+  }
+  Task<TRes> any = Task<TRes>::createContinuation(_tasks.front().core_ptr_->thread_pool_ptr_);
+  auto anyCore = any.core_ptr_;
+  auto isCompleted = std::make_shared<std::atomic<bool>>(false);
+  for (auto &task : _tasks) {
+    std::weak_ptr<TaskState<TRes>> weakState = task.core_ptr_->state_ptr_;
+    task.core_ptr_->state_ptr_->addContinuation([weakState, isCompleted, anyCore](bool _isLast) {
+      if (isCompleted->exchange(true, std::memory_order_acq_rel)) {
+        return;
+      }
+      std::shared_ptr<TaskState<TRes>> state = weakState.lock();
+      anyCore->task_ = [state]() -> TRes {
+        return state->result();
+      };
+      Task<TRes>::schedule(anyCore, _isLast);
+    });
+  }
+  return any;
+}
+
+inline
+Task<void> whenAny(std::vector<Task<void>> _tasks) {
+  if (_tasks.empty()) {
+    throw icc::threadpool::TaskInvalid("_tasks in whenAny are empty !!");
+  }
+  Task<void> any = Task<void>::createContinuation(_tasks.front().core_ptr_->thread_pool_ptr_);
+  auto anyCore = any.core_ptr_;
+  auto isCompleted = std::make_shared<std::atomic<bool>>(false);
+  for (auto &task : _tasks) {
+    std::weak_ptr<TaskState<void>> weakState = task.core_ptr_->state_ptr_;
+    task.core_ptr_->state_ptr_->addContinuation([weakState, isCompleted, anyCore](bool _isLast) {
+      if (isCompleted->exchange(true, std::memory_order_acq_rel)) {
+        return;
+      }
+      std::shared_ptr<TaskState<void>> state = weakState.lock();
+      anyCore->task_ = [state] {
+        state->result();
+      };
+      Task<void>::schedule(anyCore, _isLast);
+    });
+  }
+  return any;
+}
+
 }
 
 }
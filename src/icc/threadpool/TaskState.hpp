@@ -0,0 +1,147 @@
+/**
+ * @file TaskState.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains TaskState class.
+ * It is shared completion state of Task: result or exception of task
+ * and continuations that are called when task is completed
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_TREADPOOL_TASKSTATE_HPP
+#define ICC_TREADPOOL_TASKSTATE_HPP
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace icc {
+
+namespace threadpool {
+
+class TaskStateBase {
+ public:
+  /**
+   * Continuation gets true if it is the last one called on this thread,
+   * such continuation could be executed in place without losing parallelism
+   */
+  using Continuation = std::function<void(bool _isLast)>;
+
+  /**
+   * Adds continuation that is called from thread that completes task.
+   * If task is already completed continuation is called in place
+   * @param _continuation Continuation to add
+   */
+  void addContinuation(Continuation _continuation) {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      has_continuations_ = true;
+      if (!is_completed_) {
+        continuations_.push_back(std::move(_continuation));
+        return;
+      }
+    }
+    _continuation(true);
+  }
+
+  /**
+   * Completes task with exception
+   * @param _exception Exception thrown by task
+   */
+  void setException(std::exception_ptr _exception) {
+    std::unique_lock<std::mutex> lock{mtx_};
+    exception_ = std::move(_exception);
+    complete(lock);
+  }
+
+  bool hasContinuations() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return has_continuations_;
+  }
+
+  bool isCompleted() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return is_completed_;
+  }
+
+  std::exception_ptr exception() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return exception_;
+  }
+
+ protected:
+  /**
+   * Marks task as completed and calls continuations without holding the lock
+   */
+  void complete(std::unique_lock<std::mutex> &lock) {
+    is_completed_ = true;
+    std::vector<Continuation> continuations;
+    continuations.swap(continuations_);
+    lock.unlock();
+    for (std::size_t i = 0; i < continuations.size(); ++i) {
+      continuations[i](i + 1 == continuations.size());
+    }
+  }
+
+  void rethrowIfFailed(const std::lock_guard<std::mutex> &) const {
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+  mutable std::mutex mtx_;
+  bool is_completed_ = false;
+  bool has_continuations_ = false;
+  std::exception_ptr exception_;
+  std::vector<Continuation> continuations_;
+};
+
+template <typename TRes>
+class TaskState : public TaskStateBase {
+ public:
+  void setResult(TRes _result) {
+    std::unique_lock<std::mutex> lock{mtx_};
+    result_.reset(new TRes(std::move(_result)));
+    complete(lock);
+  }
+
+  /**
+   * Result of completed task
+   * @return Result of task, rethrows exception of task
+   */
+  const TRes & result() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    rethrowIfFailed(lock);
+    return *result_;
+  }
+
+ private:
+  std::unique_ptr<TRes> result_;
+};
+
+template <>
+class TaskState<void> : public TaskStateBase {
+ public:
+  void setResult() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    complete(lock);
+  }
+
+  /**
+   * Rethrows exception of completed task if any
+   */
+  void result() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    rethrowIfFailed(lock);
+  }
+};
+
+}
+
+}
+
+#endif //ICC_TREADPOOL_TASKSTATE_HPP
@@ -6,9 +6,15 @@
  * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
  */
 
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <stdexcept>
 #include <thread>
 #include <utility>
 
+#include <icc/_private/containers/TimerQueue.hpp>
+#include <icc/_private/containers/WorkStealingDeque.hpp>
 #include "ThreadPool.hpp"
 #include "Task.hpp"
 
@@ -16,17 +22,532 @@ namespace icc {
 
 namespace threadpool {
 
-ThreadPool::ThreadPool(const unsigned _numThreads) {
-  try {
-    for (int i = 0; i < _numThreads; ++i) {
-      threads_.emplace_back([this] {
-        while (!task_queue_.isInterrupt()) {
-          Action task = task_queue_.waitPop();
-          if (task) {
-            task();
+constexpr unsigned ThreadPool::kMaxDispatchDepth;
+
+namespace {
+
+/**
+ * ThreadPool and index of worker that owns current thread,
+ * used for O(1) membership checks, to push tasks spawned from worker
+ * in its own deque and to find elastic ThreadPool in BlockingScope
+ */
+thread_local ThreadPool *tCurrentPool = nullptr;
+thread_local std::size_t tCurrentWorkerIdx = 0;
+/**
+ * Number of tasks dispatched in place that are on stack of current thread
+ */
+thread_local unsigned tDispatchDepth = 0;
+
+/**
+ * Restores dispatch depth even if task throws
+ */
+class DispatchDepthGuard {
+ public:
+  DispatchDepthGuard() {
+    ++tDispatchDepth;
+  }
+
+  ~DispatchDepthGuard() {
+    --tDispatchDepth;
+  }
+};
+
+/**
+ * Marks current thread as thread of ThreadPool and restores previous mark
+ * even if thread body throws
+ */
+class CurrentPoolGuard {
+ public:
+  explicit CurrentPoolGuard(ThreadPool *_pool)
+    : prev_pool_(tCurrentPool) {
+    tCurrentPool = _pool;
+  }
+
+  ~CurrentPoolGuard() {
+    tCurrentPool = prev_pool_;
+  }
+
+ private:
+  ThreadPool *const prev_pool_;
+};
+
+}
+
+class ThreadPool::Worker {
+ public:
+  explicit Worker(const std::size_t _idx)
+    : random_state_{static_cast<std::uint32_t>(_idx) * 2654435761u + 1u} {
+  }
+
+  Worker(const Worker &) = delete;
+  Worker & operator=(const Worker &) = delete;
+
+  ~Worker() {
+    clear();
+    freeList(free_nodes_);
+    freeList(remote_nodes_.exchange(nullptr, std::memory_order_acquire));
+  }
+
+  /**
+   * Pushes task in deque, should be called only from thread of worker
+   * @param _task Task to push
+   */
+  void push(QueuedTask _task) {
+    TaskNode *const kNodePtr = acquireNode();
+    kNodePtr->task_ = std::move(_task);
+    deque_.push(kNodePtr);
+  }
+
+  /**
+   * Pops the last pushed task, should be called only from thread of worker
+   * @param _task Popped task
+   * @return true if task is popped
+   */
+  bool pop(QueuedTask &_task) {
+    TaskNode *const kNodePtr = deque_.pop();
+    if (kNodePtr == nullptr) {
+      return false;
+    }
+    _task = std::move(kNodePtr->task_);
+    kNodePtr->next_ = free_nodes_;
+    free_nodes_ = kNodePtr;
+    return true;
+  }
+
+  /**
+   * Steals the first pushed task, could be called from any thread.
+   * Node of task is returned to this worker through remote free list
+   * @param _task Stolen task
+   * @return true if task is stolen
+   */
+  bool steal(QueuedTask &_task) {
+    TaskNode *const kNodePtr = deque_.steal();
+    if (kNodePtr == nullptr) {
+      return false;
+    }
+    _task = std::move(kNodePtr->task_);
+    pushRemote(kNodePtr);
+    return true;
+  }
+
+  bool empty() const {
+    return deque_.empty();
+  }
+
+  /**
+   * Drops tasks left in deque, should be called when thread of worker is joined
+   */
+  void clear() {
+    QueuedTask task;
+    while (pop(task)) {
+      task = QueuedTask();
+    }
+  }
+
+  /**
+   * Xorshift generator used to choose victim of stealing
+   */
+  std::uint32_t nextRandom() {
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 17;
+    random_state_ ^= random_state_ << 5;
+    return random_state_;
+  }
+
+ private:
+  /**
+   * Node of deque that keeps task by value. Nodes are reused by worker
+   * that allocated them, so pushing of task does not allocate in steady state
+   */
+  struct TaskNode {
+    QueuedTask task_;
+    TaskNode *next_ = nullptr;
+  };
+
+  static void freeList(TaskNode *_nodePtr) {
+    while (_nodePtr != nullptr) {
+      TaskNode *const kNext = _nodePtr->next_;
+      delete _nodePtr;
+      _nodePtr = kNext;
+    }
+  }
+
+  TaskNode * acquireNode() {
+    if (free_nodes_ == nullptr) {
+      // NOTE(redra): Only owner takes remote list and it takes it whole, so there is no ABA
+      free_nodes_ = remote_nodes_.exchange(nullptr, std::memory_order_acquire);
+    }
+    TaskNode *const kNodePtr = free_nodes_;
+    if (kNodePtr == nullptr) {
+      return new TaskNode();
+    }
+    free_nodes_ = kNodePtr->next_;
+    return kNodePtr;
+  }
+
+  void pushRemote(TaskNode *_nodePtr) {
+    TaskNode *head = remote_nodes_.load(std::memory_order_relaxed);
+    do {
+      _nodePtr->next_ = head;
+    } while (!remote_nodes_.compare_exchange_weak(head, _nodePtr,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+  }
+
+  icc::_private::containers::WorkStealingDeque<TaskNode> deque_;
+  TaskNode *free_nodes_ = nullptr;
+  std::atomic<TaskNode *> remote_nodes_{nullptr};
+  std::uint32_t random_state_;
+};
+
+class ThreadPool::Elastic {
+ public:
+  using Clock = QueuedTask::Clock;
+
+  Elastic(ThreadPool &_pool, const ElasticOptions &_options)
+    : pool_(_pool)
+    , options_(_options)
+    , last_start_ns_{toNs(Clock::now())} {
+    options_.max_threads_ = std::max(1u, options_.max_threads_);
+    options_.min_threads_ = std::min(options_.min_threads_, options_.max_threads_);
+  }
+
+  void start() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    for (unsigned i = 0; i < options_.min_threads_; ++i) {
+      spawn(lock);
+    }
+    supervisor_.reset(new JThread(&Elastic::supervise, this));
+  }
+
+  /**
+   * Joins supervisor and all workers, queue should be interrupted before
+   */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      is_stopped_ = true;
+    }
+    cond_var_.notify_all();
+    supervisor_.reset();
+    std::list<WorkerThread> workers;
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      workers.swap(workers_);
+    }
+    workers.clear();
+  }
+
+  void onStart(const Clock::time_point _pushTime) {
+    const Clock::time_point kNow = Clock::now();
+    last_wait_ns_.store(toNs(kNow) - toNs(_pushTime), std::memory_order_relaxed);
+    last_start_ns_.store(toNs(kNow), std::memory_order_relaxed);
+  }
+
+  void beginBlocking() {
+    blocked_threads_.fetch_add(1, std::memory_order_relaxed);
+    std::unique_lock<std::mutex> lock{mtx_};
+    // NOTE(redra): Excess threads spawned here are retired after idle timeout
+    if (idle_threads_.load(std::memory_order_relaxed) == 0 &&
+        num_threads_.load(std::memory_order_relaxed) < options_.max_threads_ &&
+        spawn(lock)) {
+      spawned_by_blocking_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void endBlocking() {
+    blocked_threads_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  std::size_t size() const {
+    return num_threads_.load(std::memory_order_relaxed);
+  }
+
+  bool hasThread(const std::thread::id _threadId) const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return std::any_of(workers_.begin(), workers_.end(),
+    [&_threadId](const WorkerThread &_worker) {
+      return !_worker.is_finished_.load(std::memory_order_acquire) &&
+             _worker.thread_->getId() == _threadId;
+    });
+  }
+
+  void fillStats(ThreadPoolStats &_stats) const {
+    _stats.elastic_ = true;
+    _stats.num_threads_ = num_threads_.load(std::memory_order_relaxed);
+    _stats.min_threads_ = options_.min_threads_;
+    _stats.max_threads_ = options_.max_threads_;
+    _stats.peak_threads_ = peak_threads_.load(std::memory_order_relaxed);
+    _stats.idle_threads_ = idle_threads_.load(std::memory_order_relaxed);
+    _stats.blocked_threads_ = blocked_threads_.load(std::memory_order_relaxed);
+    _stats.queue_wait_ = std::chrono::nanoseconds{queue_wait_ns_.load(std::memory_order_relaxed)};
+    _stats.spawned_by_latency_ = spawned_by_latency_.load(std::memory_order_relaxed);
+    _stats.spawned_by_blocking_ = spawned_by_blocking_.load(std::memory_order_relaxed);
+    _stats.retired_threads_ = retired_threads_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct WorkerThread {
+    std::atomic<bool> is_finished_{false};
+    std::unique_ptr<JThread> thread_;
+  };
+
+  static std::int64_t toNs(const Clock::time_point _timePoint) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        _timePoint.time_since_epoch()).count();
+  }
+
+  bool spawn(const std::unique_lock<std::mutex> &) {
+    if (is_stopped_) {
+      return false;
+    }
+    workers_.emplace_back();
+    WorkerThread &worker = workers_.back();
+    try {
+      worker.thread_.reset(new JThread(&Elastic::runWorker, this, std::ref(worker)));
+    } catch (...) {
+      workers_.pop_back();
+      throw;
+    }
+    const unsigned kNumThreads = num_threads_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (kNumThreads > peak_threads_.load(std::memory_order_relaxed)) {
+      peak_threads_.store(kNumThreads, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  void runWorker(WorkerThread &_worker) {
+    tCurrentPool = &pool_;
+    while (!pool_.task_queue_.isInterrupt()) {
+      idle_threads_.fetch_add(1, std::memory_order_relaxed);
+      QueuedTask task = pool_.task_queue_.waitPop(Clock::now() + options_.idle_timeout_);
+      idle_threads_.fetch_sub(1, std::memory_order_relaxed);
+      // NOTE(redra): Every task of elastic ThreadPool is stamped on push,
+      //  so not stamped task means timeout or interruption
+      if (task.isStamped()) {
+        pool_.execute(task);
+        continue;
+      }
+      if (pool_.task_queue_.isInterrupt()) {
+        break;
+      }
+      std::lock_guard<std::mutex> lock{mtx_};
+      if (num_threads_.load(std::memory_order_relaxed) > options_.min_threads_) {
+        num_threads_.fetch_sub(1, std::memory_order_relaxed);
+        retired_threads_.fetch_add(1, std::memory_order_relaxed);
+        break;
+      }
+    }
+    tCurrentPool = nullptr;
+    _worker.is_finished_.store(true, std::memory_order_release);
+  }
+
+  /**
+   * Latency of queue: wait of the last started task or time since the last
+   * start if tasks are stuck in queue
+   */
+  Clock::duration queueWait() const {
+    if (pool_.task_queue_.empty()) {
+      return Clock::duration::zero();
+    }
+    const std::int64_t kStallNs = toNs(Clock::now()) -
+                                  last_start_ns_.load(std::memory_order_relaxed);
+    const std::int64_t kWaitNs = std::max(kStallNs, last_wait_ns_.load(std::memory_order_relaxed));
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds{kWaitNs});
+  }
+
+  void supervise() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    while (!is_stopped_) {
+      cond_var_.wait_for(lock, options_.check_period_);
+      if (is_stopped_) {
+        break;
+      }
+      // NOTE(redra): Retired worker does not need the lock after it is finished,
+      //  so its thread is joined here right away
+      workers_.remove_if([](const WorkerThread &_worker) {
+        return _worker.is_finished_.load(std::memory_order_acquire);
+      });
+      const Clock::duration kWait = queueWait();
+      queue_wait_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(kWait).count(),
+                           std::memory_order_relaxed);
+      if (kWait > options_.max_queue_wait_ &&
+          idle_threads_.load(std::memory_order_relaxed) == 0 &&
+          num_threads_.load(std::memory_order_relaxed) < options_.max_threads_ &&
+          spawn(lock)) {
+        spawned_by_latency_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  ThreadPool &pool_;
+  ElasticOptions options_;
+  mutable std::mutex mtx_;
+  std::condition_variable cond_var_;
+  bool is_stopped_ = false;
+  std::list<WorkerThread> workers_;
+  std::unique_ptr<JThread> supervisor_;
+  std::atomic<unsigned> num_threads_{0};
+  std::atomic<unsigned> peak_threads_{0};
+  std::atomic<unsigned> idle_threads_{0};
+  std::atomic<unsigned> blocked_threads_{0};
+  std::atomic<std::int64_t> last_wait_ns_{0};
+  std::atomic<std::int64_t> last_start_ns_;
+  std::atomic<std::int64_t> queue_wait_ns_{0};
+  std::atomic<std::uint64_t> spawned_by_latency_{0};
+  std::atomic<std::uint64_t> spawned_by_blocking_{0};
+  std::atomic<std::uint64_t> retired_threads_{0};
+};
+
+class ThreadPool::Scheduler {
+ public:
+  explicit Scheduler(ThreadPool &_pool)
+    : pool_(_pool) {
+    thread_.reset(new JThread(&Scheduler::run, this));
+  }
+
+  ~Scheduler() {
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      is_stopped_ = true;
+    }
+    cond_var_.notify_one();
+    thread_.reset();
+  }
+
+  TimerHandle add(Action _task, const TimerClock::time_point _timePoint,
+                  const TimerClock::duration _period, const OverrunPolicy _policy) {
+    TimerHandle handle = TimerHandle::create();
+    auto scheduled = std::make_shared<Scheduled>(std::move(_task), handle, _policy);
+    {
+      std::lock_guard<std::mutex> lock{mtx_};
+      queue_.push(std::move(scheduled), _timePoint, _period, handle, _policy);
+    }
+    cond_var_.notify_one();
+    return handle;
+  }
+
+ private:
+  /**
+   * Schedule shared between timer thread and runs of its task on ThreadPool
+   */
+  class Scheduled : public std::enable_shared_from_this<Scheduled> {
+   public:
+    Scheduled(Action _task, TimerHandle _handle, const OverrunPolicy _policy)
+      : task_(std::move(_task))
+      , handle_(std::move(_handle))
+      , policy_(_policy) {
+    }
+
+    /**
+     * Called from timer thread when schedule is due
+     */
+    void fire(ThreadPool &_pool) {
+      {
+        std::lock_guard<std::mutex> lock{mtx_};
+        if (is_running_) {
+          if (OverrunPolicy::CatchUp == policy_) {
+            ++num_missed_;
           }
+          return;
         }
+        is_running_ = true;
+      }
+      std::shared_ptr<Scheduled> self = shared_from_this();
+      _pool.push([self] {
+        self->execute();
+      });
+    }
+
+   private:
+    void execute() {
+      for (;;) {
+        if (!handle_.isCancelled() && task_) {
+          task_();
+        }
+        std::lock_guard<std::mutex> lock{mtx_};
+        if (num_missed_ == 0 || handle_.isCancelled()) {
+          is_running_ = false;
+          return;
+        }
+        --num_missed_;
+      }
+    }
+
+    std::mutex mtx_;
+    bool is_running_ = false;
+    std::size_t num_missed_ = 0;
+    Action task_;
+    TimerHandle handle_;
+    const OverrunPolicy policy_;
+  };
+
+  void run() {
+    std::vector<std::shared_ptr<Scheduled>> dueTasks;
+    std::unique_lock<std::mutex> lock{mtx_};
+    while (!is_stopped_) {
+      const TimerClock::time_point kNextTimePoint = queue_.nextTimePoint();
+      if (kNextTimePoint == TimerClock::time_point::max()) {
+        cond_var_.wait(lock);
+      } else {
+        cond_var_.wait_until(lock, kNextTimePoint);
+      }
+      if (is_stopped_) {
+        break;
+      }
+      queue_.handleExpired(TimerClock::now(), [&dueTasks](std::shared_ptr<Scheduled> &_scheduled) {
+        dueTasks.push_back(_scheduled);
       });
+      if (dueTasks.empty()) {
+        continue;
+      }
+      // NOTE(redra): Tasks are pushed without the lock, so pushing
+      //  in bounded queue does not block adding of new schedules
+      lock.unlock();
+      for (auto &scheduled : dueTasks) {
+        scheduled->fire(pool_);
+      }
+      dueTasks.clear();
+      lock.lock();
+    }
+  }
+
+  ThreadPool &pool_;
+  std::mutex mtx_;
+  std::condition_variable cond_var_;
+  bool is_stopped_ = false;
+  icc::_private::containers::TimerQueue<std::shared_ptr<Scheduled>> queue_;
+  std::unique_ptr<JThread> thread_;
+};
+
+ThreadPool::BlockingScope::BlockingScope() {
+  if (tCurrentPool && tCurrentPool->elastic_) {
+    pool_ = tCurrentPool;
+    pool_->elastic_->beginBlocking();
+  }
+}
+
+ThreadPool::BlockingScope::~BlockingScope() {
+  if (pool_) {
+    pool_->elastic_->endBlocking();
+  }
+}
+
+ThreadPool::ThreadPool(const unsigned _numThreads,
+                       const SchedulingPolicy _policy)
+  : policy_{_policy} {
+  try {
+    if (SchedulingPolicy::WorkStealing == policy_) {
+      for (unsigned i = 0; i < _numThreads; ++i) {
+        workers_.emplace_back(new Worker(i));
+      }
+      for (unsigned i = 0; i < _numThreads; ++i) {
+        threads_.emplace_back(&ThreadPool::runWorker, this, i);
+      }
+      return;
+    }
+    for (int i = 0; i < _numThreads; ++i) {
+      threads_.emplace_back(&ThreadPool::runSharedQueue, this);
     }
   } catch (...) {
     stop();
@@ -38,15 +559,13 @@ ThreadPool::ThreadPool(const ThreadAction& initThreadTask,
                        const unsigned _numThreads) {
   try {
     ThreadLoop threadLoop = [this] {
-      while (!task_queue_.isInterrupt()) {
-        Action task = task_queue_.waitPop();
-        if (task) {
-          task();
-        }
-      }
+      runSharedQueue();
     };
     for (int i = 0; i < _numThreads; ++i) {
-      threads_.emplace_back([initThreadTask, threadLoop] {
+      // NOTE(redra): Whole body of thread belongs to ThreadPool,
+      //  so hasThread() is true in initThreadTask before and after threadLoop
+      threads_.emplace_back([this, initThreadTask, threadLoop] {
+        CurrentPoolGuard guard{this};
         initThreadTask(threadLoop);
       });
     }
@@ -56,13 +575,41 @@ ThreadPool::ThreadPool(const ThreadAction& initThreadTask,
   }
 }
 
+ThreadPool::ThreadPool(const ElasticOptions &_options)
+  : elastic_{new Elastic(*this, _options)} {
+  try {
+    elastic_->start();
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
 ThreadPool::~ThreadPool() {
   stop();
 }
 
 void ThreadPool::stop() {
+  {
+    // NOTE(redra): Schedules added after this point are rejected, so scheduler
+    //  could be destroyed after threads that could still add schedules are joined
+    std::lock_guard<std::mutex> lock{scheduler_mtx_};
+    is_stopped_.store(true, std::memory_order_seq_cst);
+  }
   task_queue_.interrupt();
+  {
+    std::lock_guard<std::mutex> lock{park_mtx_};
+    ++wake_epoch_;
+  }
+  park_cond_var_.notify_all();
   threads_.clear();
+  if (elastic_) {
+    elastic_->stop();
+  }
+  scheduler_.reset();
+  for (auto &worker : workers_) {
+    worker->clear();
+  }
 }
 
 ThreadPool&
@@ -72,8 +619,14 @@ ThreadPool::getDefaultPool(const unsigned _numThreads) {
 }
 
 std::shared_ptr<ThreadPool>
-ThreadPool::createPool(const unsigned _numThreads) {
-  return std::shared_ptr<ThreadPool>(new ThreadPool(_numThreads));
+ThreadPool::createPool(const unsigned _numThreads,
+                       const SchedulingPolicy _policy) {
+  return std::shared_ptr<ThreadPool>(new ThreadPool(_numThreads, _policy));
+}
+
+std::shared_ptr<ThreadPool>
+ThreadPool::createElasticPool(const ElasticOptions &_options) {
+  return std::shared_ptr<ThreadPool>(new ThreadPool(_options));
 }
 
 std::shared_ptr<ThreadPool>
@@ -83,16 +636,221 @@ ThreadPool::createCustomPool(const ThreadAction& threadTask,
 }
 
 void ThreadPool::push(Action _task) {
-  task_queue_.push(std::move(_task));
+  push(std::move(_task), Priority::Normal);
+}
+
+void ThreadPool::push(Action _task, const Priority _priority) {
+  pushTask(QueuedTask(std::move(_task)), _priority);
+}
+
+void ThreadPool::push(Action _task, CancellationToken _token,
+                      const Priority _priority) {
+  pushTask(QueuedTask(std::move(_task), std::move(_token)), _priority);
+}
+
+void ThreadPool::pushTask(QueuedTask _task, const Priority _priority) {
+  if (elastic_) {
+    _task.push_time_ = Elastic::Clock::now();
+    task_queue_.push(std::move(_task), _priority);
+    return;
+  }
+  if (SchedulingPolicy::SharedQueue == policy_) {
+    task_queue_.push(std::move(_task), _priority);
+    return;
+  }
+  if (Priority::Normal == _priority && tCurrentPool == this) {
+    workers_[tCurrentWorkerIdx]->push(std::move(_task));
+  } else if (Priority::High == _priority) {
+    // NOTE(redra): Counter makes workers look into injection queue before own deque
+    _task.is_high_priority_ = true;
+    high_priority_tasks_.fetch_add(1, std::memory_order_release);
+    task_queue_.push(std::move(_task), _priority);
+  } else {
+    task_queue_.push(std::move(_task), _priority);
+  }
+  notifyWorker();
+}
+
+void ThreadPool::execute(QueuedTask &_task) {
+  if (_task.is_high_priority_) {
+    high_priority_tasks_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  if (elastic_ && _task.isStamped()) {
+    elastic_->onStart(_task.push_time_);
+  }
+  if (!_task.token_.isCancelled() && _task.action_) {
+    _task.action_();
+  }
+}
+
+void ThreadPool::dispatch(Action _task, const Priority _priority) {
+  if (tCurrentPool == this && tDispatchDepth < kMaxDispatchDepth) {
+    DispatchDepthGuard guard;
+    if (_task) {
+      _task();
+    }
+    return;
+  }
+  push(std::move(_task), _priority);
+}
+
+ThreadPool * ThreadPool::current() {
+  return tCurrentPool;
+}
+
+TimerHandle ThreadPool::scheduleAfter(const TimerClock::duration _delay, Action _task) {
+  return scheduleAt(TimerClock::now() + _delay, std::move(_task));
+}
+
+TimerHandle ThreadPool::scheduleAt(const TimerClock::time_point _timePoint, Action _task) {
+  return addSchedule(std::move(_task), _timePoint,
+                     TimerClock::duration::zero(), OverrunPolicy::Skip);
+}
+
+TimerHandle ThreadPool::scheduleEvery(const TimerClock::duration _period, Action _task,
+                                      const OverrunPolicy _policy) {
+  if (_period <= TimerClock::duration::zero()) {
+    throw std::invalid_argument("_period of scheduleEvery should be positive !!");
+  }
+  return addSchedule(std::move(_task), TimerClock::now() + _period, _period, _policy);
+}
+
+TimerHandle ThreadPool::addSchedule(Action _task, const TimerClock::time_point _timePoint,
+                                    const TimerClock::duration _period,
+                                    const OverrunPolicy _policy) {
+  std::lock_guard<std::mutex> lock{scheduler_mtx_};
+  if (is_stopped_.load(std::memory_order_acquire)) {
+    return TimerHandle{};
+  }
+  if (!scheduler_) {
+    scheduler_.reset(new Scheduler(*this));
+  }
+  return scheduler_->add(std::move(_task), _timePoint, _period, _policy);
 }
 
 bool ThreadPool::hasThread(std::thread::id _threadId) const {
+  if (std::this_thread::get_id() == _threadId) {
+    return tCurrentPool == this;
+  }
+  if (elastic_) {
+    return elastic_->hasThread(_threadId);
+  }
   return std::any_of(threads_.begin(), threads_.end(),
   [&_threadId](const JThread & _thread) {
     return _thread.getId() == _threadId;
   });
 }
 
+std::size_t ThreadPool::size() const {
+  if (elastic_) {
+    return elastic_->size();
+  }
+  return threads_.size();
+}
+
+ThreadPoolStats ThreadPool::stats() const {
+  ThreadPoolStats stats;
+  stats.queue_depth_ = task_queue_.count();
+  if (elastic_) {
+    elastic_->fillStats(stats);
+    return stats;
+  }
+  stats.num_threads_ = static_cast<unsigned>(threads_.size());
+  stats.min_threads_ = stats.num_threads_;
+  stats.max_threads_ = stats.num_threads_;
+  stats.peak_threads_ = stats.num_threads_;
+  return stats;
+}
+
+void ThreadPool::runSharedQueue() {
+  CurrentPoolGuard guard{this};
+  while (!task_queue_.isInterrupt()) {
+    QueuedTask task = task_queue_.waitPop();
+    execute(task);
+  }
+}
+
+void ThreadPool::runWorker(const std::size_t _workerIdx) {
+  tCurrentPool = this;
+  tCurrentWorkerIdx = _workerIdx;
+  Worker &worker = *workers_[_workerIdx];
+  while (!is_stopped_.load(std::memory_order_acquire)) {
+    if (high_priority_tasks_.load(std::memory_order_acquire) > 0) {
+      QueuedTask task;
+      if (task_queue_.tryPop(task)) {
+        execute(task);
+        continue;
+      }
+    }
+    QueuedTask task;
+    if (findTask(worker, task)) {
+      execute(task);
+      continue;
+    }
+    if (task_queue_.tryPop(task)) {
+      execute(task);
+      continue;
+    }
+    parkWorker();
+  }
+  tCurrentPool = nullptr;
+}
+
+bool ThreadPool::findTask(Worker &_worker, QueuedTask &_task) {
+  if (_worker.pop(_task)) {
+    return true;
+  }
+  const std::size_t kNumWorkers = workers_.size();
+  const std::size_t kStartIdx = _worker.nextRandom() % kNumWorkers;
+  for (std::size_t i = 0; i < kNumWorkers; ++i) {
+    Worker &victim = *workers_[(kStartIdx + i) % kNumWorkers];
+    if (&victim == &_worker) {
+      continue;
+    }
+    if (victim.steal(_task)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::hasTasks() const {
+  if (!task_queue_.empty()) {
+    return true;
+  }
+  return std::any_of(workers_.begin(), workers_.end(),
+  [](const std::unique_ptr<Worker> &_worker) {
+    return !_worker->empty();
+  });
+}
+
+void ThreadPool::parkWorker() {
+  std::unique_lock<std::mutex> lock{park_mtx_};
+  const std::uint64_t kEpoch = wake_epoch_;
+  sleeping_workers_.fetch_add(1, std::memory_order_seq_cst);
+  // NOTE(redra): Pairs with fence in notifyWorker, either worker sees
+  //  new task or producer sees sleeping worker
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!hasTasks()) {
+    park_cond_var_.wait(lock, [this, kEpoch] {
+      return wake_epoch_ != kEpoch ||
+             is_stopped_.load(std::memory_order_acquire);
+    });
+  }
+  sleeping_workers_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::notifyWorker() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleeping_workers_.load(std::memory_order_seq_cst) > 0) {
+    {
+      std::lock_guard<std::mutex> lock{park_mtx_};
+      ++wake_epoch_;
+    }
+    park_cond_var_.notify_one();
+  }
+}
+
 }
 
 }
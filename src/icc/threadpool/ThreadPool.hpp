@@ -10,36 +10,113 @@
 #define ICC_THREADPOOL_HPP
 
 #include <queue>
+#include <algorithm>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <condition_variable>
+#include <thread>
 
+#include <icc/Action.hpp>
 #include <icc/Component.hpp>
 #include <icc/_private/helpers/memory_helpers.hpp>
+#include <icc/_private/helpers/stats_helpers.hpp>
 #include <icc/_private/api.hpp>
+#include "CancellationToken.hpp"
 #include "JThread.hpp"
+#include "ThreadPoolStats.hpp"
 
 namespace icc {
 
 namespace threadpool {
 
-using Action = std::function<void(void)>;
+using Action = icc::Action;
+using Priority = icc::Priority;
+using TimerClock = icc::TimerClock;
+using TimerHandle = icc::TimerHandle;
+using OverrunPolicy = icc::OverrunPolicy;
 using ThreadSafeActionQueue = icc::_private::containers::ThreadSafeQueue<Action>;
 
 template <typename T>
 class Task;
 
+/**
+ * Policy of distributing tasks between threads of ThreadPool
+ */
+enum class SchedulingPolicy {
+  /**
+   * All threads take tasks from single shared queue
+   */
+  SharedQueue,
+  /**
+   * Each thread has own lock-free deque. Tasks pushed from thread of pool
+   * go to its deque in LIFO order, idle threads steal tasks from random
+   * deques. Tasks pushed from outside go to shared injection queue.
+   * Suits CPU-bound fork/join workloads
+   */
+  WorkStealing,
+};
+
+/**
+ * Options of elastic ThreadPool that changes number of threads in runtime
+ */
+struct ElasticOptions {
+  unsigned min_threads_ = 1;
+  unsigned max_threads_ = 4 * std::max(1u, std::thread::hardware_concurrency());
+  /**
+   * Queue latency after which new thread is spawned if there is no idle one
+   */
+  std::chrono::milliseconds max_queue_wait_{10};
+  /**
+   * Thread above min_threads_ that waits for tasks longer is retired
+   */
+  std::chrono::milliseconds idle_timeout_{30000};
+  /**
+   * Period of checking queue latency
+   */
+  std::chrono::milliseconds check_period_{5};
+};
+
 class ICC_PUBLIC ThreadPool
     : public icc::helpers::virtual_enable_shared_from_this< ThreadPool > {
  public:
   using ThreadLoop = std::function<void(void)>;
   using ThreadAction = std::function<void(const ThreadLoop&)>;
 
+  /**
+   * Marks current thread of elastic ThreadPool as blocked while scope is alive,
+   * e.g. around Socket::send() or waiting for future. If there is no idle
+   * thread, ThreadPool spawns compensating one. Does nothing on other threads
+   */
+  class BlockingScope {
+   public:
+    BlockingScope();
+    ~BlockingScope();
+    BlockingScope(const BlockingScope &) = delete;
+    BlockingScope & operator=(const BlockingScope &) = delete;
+
+   private:
+    ThreadPool *pool_ = nullptr;
+  };
+
   ~ThreadPool() override;
 
   static ThreadPool & getDefaultPool(
       unsigned _numThreads = std::thread::hardware_concurrency());
 
   static std::shared_ptr<ThreadPool> createPool(
-      unsigned _numThreads = std::thread::hardware_concurrency());
+      unsigned _numThreads = std::thread::hardware_concurrency(),
+      SchedulingPolicy _policy = SchedulingPolicy::SharedQueue);
+
+  /**
+   * Creates ThreadPool with shared queue that spawns threads when tasks wait
+   * in queue longer than ElasticOptions::max_queue_wait_ and retires threads
+   * that are idle longer than ElasticOptions::idle_timeout_
+   * @param _options Options of elastic ThreadPool
+   * @return Elastic ThreadPool
+   */
+  static std::shared_ptr<ThreadPool> createElasticPool(const ElasticOptions &_options = ElasticOptions());
 
   static std::shared_ptr<ThreadPool> createCustomPool(
       const ThreadAction& threadTask,
@@ -56,24 +133,156 @@ class ICC_PUBLIC ThreadPool
    */
   void push(Action _task);
 
+  /**
+   * Method used to push task with priority class.
+   * Tasks with Priority::High are taken before tasks with Priority::Normal,
+   * Priority::Low tasks are taken when there are no other tasks
+   * @param _task Task that will be executed
+   * @param _priority Priority of task
+   */
+  void push(Action _task, Priority _priority);
+
+  /**
+   * Method used to push task that is skipped if _token is cancelled
+   * before task is taken from queue
+   * @param _task Task that will be executed
+   * @param _token Token checked right before execution
+   * @param _priority Priority of task
+   */
+  void push(Action _task, CancellationToken _token,
+            Priority _priority = Priority::Normal);
+
+  /**
+   * Maximum number of nested tasks that dispatch() executes in place
+   */
+  static constexpr unsigned kMaxDispatchDepth = 16;
+
+  /**
+   * Method used to execute short task or continuation in place if it is
+   * called from thread of this ThreadPool, so task skips round-trip through
+   * queue. Otherwise or if nesting of dispatch() exceeds kMaxDispatchDepth
+   * task is pushed
+   * @param _task Task that will be executed
+   * @param _priority Priority of task if it is pushed
+   */
+  void dispatch(Action _task, Priority _priority = Priority::Normal);
+
+  /**
+   * Method used to get ThreadPool that owns current thread
+   * @return ThreadPool of current thread or nullptr
+   */
+  static ThreadPool * current();
+
+  /**
+   * Method used to push task when _delay is elapsed.
+   * All schedules of ThreadPool share single timer thread
+   * that pushes due tasks in queue of ThreadPool
+   * @param _delay Delay before task is pushed
+   * @param _task Task that will be executed
+   * @return Handle used to cancel task, empty handle if ThreadPool is stopped
+   */
+  TimerHandle scheduleAfter(TimerClock::duration _delay, Action _task);
+
+  /**
+   * Method used to push task at _timePoint
+   * @param _timePoint Time point when task is pushed
+   * @param _task Task that will be executed
+   * @return Handle used to cancel task, empty handle if ThreadPool is stopped
+   */
+  TimerHandle scheduleAt(TimerClock::time_point _timePoint, Action _task);
+
+  /**
+   * Method used to push task every _period. Time points are counted
+   * from the first one, so schedule does not drift. Runs of the same
+   * schedule never overlap: period that is due while previous run is not
+   * finished is skipped or run right after it depending on _policy
+   * @param _period Period of task
+   * @param _task Task that will be executed
+   * @param _policy Policy for overrun periods
+   * @return Handle used to cancel task, empty handle if ThreadPool is stopped
+   */
+  TimerHandle scheduleEvery(TimerClock::duration _period, Action _task,
+                            OverrunPolicy _policy = OverrunPolicy::Skip);
+
   /**
    * Method used to check if thread with id _threadId
-   * is owned by this ThreadPool
+   * is owned by this ThreadPool. Check of current thread is O(1)
    * @param _threadId Thread Id to check
    * @return true if thread belongs to, false otherwise
    */
   bool hasThread(std::thread::id _threadId) const;
 
+  /**
+   * Method used to get number of threads in ThreadPool
+   * @return Number of threads
+   */
+  std::size_t size() const;
+
+  /**
+   * Method used to get snapshot of size of ThreadPool
+   * and of resize decisions of elastic ThreadPool
+   * @return Stats of ThreadPool
+   */
+  ThreadPoolStats stats() const;
+
  protected:
-  explicit ThreadPool(unsigned _numThreads);
+  explicit ThreadPool(unsigned _numThreads,
+                      SchedulingPolicy _policy = SchedulingPolicy::SharedQueue);
   explicit ThreadPool(const ThreadAction& initThreadTask, unsigned _numThreads);
+  explicit ThreadPool(const ElasticOptions &_options);
   /**
    * Method that stop ThreadPool
    */
   void stop();
 
-  ThreadSafeActionQueue task_queue_;
+  /**
+   * Task in queue of ThreadPool. Time of push, cancellation token and
+   * priority are kept in queue node next to Action,
+   * so task is not wrapped into another Action at each layer
+   */
+  struct QueuedTask : icc::helpers::StampedAction {
+    QueuedTask() = default;
+
+    explicit QueuedTask(Action _action, CancellationToken _token = CancellationToken())
+      : icc::helpers::StampedAction(std::move(_action))
+      , token_(std::move(_token)) {
+    }
+
+    CancellationToken token_;
+    bool is_high_priority_ = false;
+  };
+
+  icc::_private::containers::ThreadSafeQueue<QueuedTask> task_queue_;
   std::vector<JThread> threads_;
+
+ private:
+  class Worker;
+  class Elastic;
+  class Scheduler;
+
+  TimerHandle addSchedule(Action _task, TimerClock::time_point _timePoint,
+                          TimerClock::duration _period, OverrunPolicy _policy);
+
+  void pushTask(QueuedTask _task, Priority _priority);
+  void execute(QueuedTask &_task);
+  void runSharedQueue();
+  void runWorker(std::size_t _workerIdx);
+  bool findTask(Worker &_worker, QueuedTask &_task);
+  bool hasTasks() const;
+  void parkWorker();
+  void notifyWorker();
+
+  const SchedulingPolicy policy_ = SchedulingPolicy::SharedQueue;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<bool> is_stopped_{false};
+  std::atomic<unsigned> sleeping_workers_{0};
+  std::atomic<unsigned> high_priority_tasks_{0};
+  std::mutex park_mtx_;
+  std::condition_variable park_cond_var_;
+  std::uint64_t wake_epoch_ = 0;
+  std::unique_ptr<Elastic> elastic_;
+  std::mutex scheduler_mtx_;
+  std::unique_ptr<Scheduler> scheduler_;
 };
 
 }
@@ -0,0 +1,61 @@
+/**
+ * @file ThreadPoolStats.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains ThreadPoolStats structure.
+ * It is snapshot of size of ThreadPool and of decisions
+ * of elastic ThreadPool to spawn and retire threads
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_THREADPOOL_THREADPOOLSTATS_HPP
+#define ICC_THREADPOOL_THREADPOOLSTATS_HPP
+
+#include <chrono>
+#include <cstdint>
+
+namespace icc {
+
+namespace threadpool {
+
+struct ThreadPoolStats {
+  /**
+   * Whether ThreadPool changes number of threads in runtime
+   */
+  bool elastic_ = false;
+  unsigned num_threads_ = 0;
+  unsigned min_threads_ = 0;
+  unsigned max_threads_ = 0;
+  unsigned peak_threads_ = 0;
+  /**
+   * Number of threads that wait for tasks
+   */
+  unsigned idle_threads_ = 0;
+  /**
+   * Number of threads inside of ThreadPool::BlockingScope
+   */
+  unsigned blocked_threads_ = 0;
+  std::uint64_t queue_depth_ = 0;
+  /**
+   * Queue latency observed by the last check of elastic ThreadPool
+   */
+  std::chrono::nanoseconds queue_wait_{0};
+  /**
+   * Threads spawned because queue latency exceeded the threshold
+   */
+  std::uint64_t spawned_by_latency_ = 0;
+  /**
+   * Threads spawned to compensate blocked threads
+   */
+  std::uint64_t spawned_by_blocking_ = 0;
+  /**
+   * Threads retired after idle timeout
+   */
+  std::uint64_t retired_threads_ = 0;
+};
+
+}
+
+}
+
+#endif //ICC_THREADPOOL_THREADPOOLSTATS_HPP
@@ -0,0 +1,41 @@
+/**
+ * @file TaskCancelled.hpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Throws when task is cancelled through CancellationToken
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#ifndef ICC_TREADPOOL_TASKCANCELLED_HPP
+#define ICC_TREADPOOL_TASKCANCELLED_HPP
+
+#include <icc/exceptions/ICCException.hpp>
+#include <string>
+
+namespace icc {
+
+namespace threadpool {
+
+class TaskCancelled : public icc::ICCException {
+ public:
+  TaskCancelled(const char * _reason) {
+    reason_ = _reason;
+  }
+
+  TaskCancelled(const std::string _reason) {
+    reason_ = _reason;
+  }
+
+  virtual const char *what() const noexcept override {
+    return reason_.c_str();
+  }
+
+ private:
+  std::string reason_;
+};
+
+}
+
+}
+
+#endif //ICC_TREADPOOL_TASKCANCELLED_HPP
@@ -0,0 +1,89 @@
+/**
+ * @file ActionTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for Action class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <future>
+#include <type_traits>
+#include <icc/Action.hpp>
+#include <icc/Context.hpp>
+
+TEST(ActionTest, EmptyCallables_ProduceEmptyAction)
+{
+  icc::Action defaultAction;
+  icc::Action nullAction = nullptr;
+  icc::Action emptyFunctionAction = std::function<void(void)>();
+  void (*nullFunction)() = nullptr;
+  icc::Action nullFunctionAction = nullFunction;
+
+  EXPECT_FALSE(defaultAction);
+  EXPECT_FALSE(nullAction);
+  EXPECT_FALSE(emptyFunctionAction);
+  EXPECT_FALSE(nullFunctionAction);
+  EXPECT_THROW(defaultAction(), std::bad_function_call);
+}
+
+TEST(ActionTest, OnlyCallablesWithoutArguments_AreConvertible)
+{
+  auto withoutArguments = [] {
+  };
+  auto withArgument = [](int) {
+  };
+  EXPECT_TRUE((std::is_convertible<decltype(withoutArguments), icc::Action>::value));
+  EXPECT_TRUE((std::is_convertible<void (*)(), icc::Action>::value));
+  EXPECT_FALSE((std::is_convertible<decltype(withArgument), icc::Action>::value));
+  EXPECT_FALSE((std::is_convertible<int, icc::Action>::value));
+  EXPECT_FALSE((std::is_convertible<std::chrono::milliseconds, icc::Action>::value));
+}
+
+TEST(ActionTest, MoveOnlyCapture_IsInvokedAfterMove)
+{
+  int result = 0;
+  std::unique_ptr<int> value{new int{42}};
+  icc::Action action = [&result, value = std::move(value)] {
+    result = *value;
+  };
+  icc::Action movedAction = std::move(action);
+
+  EXPECT_FALSE(action);
+  ASSERT_TRUE(movedAction);
+  movedAction();
+  EXPECT_EQ(result, 42);
+}
+
+TEST(ActionTest, BigCapture_IsStoredOnHeap)
+{
+  std::array<char, 2 * icc::Action::kInlineSize> buffer{};
+  buffer.back() = 7;
+  char result = 0;
+  icc::Action action = [&result, buffer] {
+    result = buffer.back();
+  };
+  icc::Action movedAction = std::move(action);
+  movedAction();
+  EXPECT_EQ(result, 7);
+}
+
+TEST(ActionTest, PromiseCapture_IsPushedInContextWithoutSharedPtr)
+{
+  auto context = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  auto channel = context->createChannel();
+  std::promise<int> promise;
+  auto result = promise.get_future();
+  channel->push([promise = std::move(promise)]() mutable {
+    promise.set_value(42);
+  });
+  channel->push([context] {
+    context->stop();
+  });
+  context->run();
+
+  EXPECT_EQ(result.get(), 42);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file ContextGroupTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for ContextGroup class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <future>
+#include <string>
+#include <thread>
+#include <icc/ContextGroup.hpp>
+
+namespace {
+
+std::thread::id getShardThreadId(icc::IContext::IChannel &_channel) {
+  std::promise<std::thread::id> threadId;
+  auto result = threadId.get_future();
+  _channel.push([&threadId] {
+    threadId.set_value(std::this_thread::get_id());
+  });
+  return result.get();
+}
+
+}
+
+TEST(ContextGroupTest, Placement_ChannelsAreBoundToShards)
+{
+  std::vector<icc::ShardOptions> shardOptions(3);
+  for (std::size_t i = 0; i < shardOptions.size(); ++i) {
+    shardOptions[i].name_ = "test-shard-" + std::to_string(i);
+  }
+  auto group = icc::ContextGroup::createGroup(shardOptions);
+  ASSERT_EQ(group->size(), 3);
+
+  std::vector<std::thread::id> shardThreads;
+  for (std::size_t i = 0; i < group->size(); ++i) {
+    auto channel = group->createChannel(i);
+    shardThreads.push_back(getShardThreadId(*channel));
+    EXPECT_EQ(shardThreads.back(), group->getContext(i)->getThreadId());
+  }
+  EXPECT_NE(shardThreads[0], shardThreads[1]);
+  EXPECT_NE(shardThreads[1], shardThreads[2]);
+
+  for (std::size_t i = 0; i < 2 * group->size(); ++i) {
+    auto channel = group->createChannelRoundRobin();
+    EXPECT_EQ(getShardThreadId(*channel), shardThreads[i % group->size()]);
+  }
+
+  auto firstChannel = group->createChannelByKey(std::string{"component"});
+  auto secondChannel = group->createChannelByKey(std::string{"component"});
+  EXPECT_EQ(getShardThreadId(*firstChannel), getShardThreadId(*secondChannel));
+  EXPECT_EQ(getShardThreadId(*group->createChannelByHash(4)), shardThreads[1]);
+}
+
+TEST(ContextGroupTest, Stop_PendingActionsAreExecuted)
+{
+  auto group = icc::ContextGroup::createGroup(2);
+  std::atomic<int> executedCount{0};
+  {
+    auto channel = group->createChannel(1);
+    for (int i = 0; i < 1000; ++i) {
+      channel->push([&executedCount] {
+        ++executedCount;
+      });
+    }
+  }
+  group->stop();
+  EXPECT_EQ(executedCount.load(), 1000);
+}
@@ -0,0 +1,319 @@
+/**
+ * @file ContextTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for Context class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <icc/Context.hpp>
+
+TEST(ContextTest, BatchDraining_ExecutesAllActionsInOrder)
+{
+  auto context = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  context->setMaxBatchSize(64);
+  auto channel = context->createChannel();
+  const int kNumActions = 100000;
+  std::vector<int> executed;
+  executed.reserve(kNumActions);
+  for (int i = 0; i < kNumActions; ++i) {
+    channel->push([i, &executed] {
+      executed.push_back(i);
+    });
+  }
+  channel->push([context] {
+    context->stop();
+  });
+  channel->push([&executed] {
+    executed.push_back(-1);
+  });
+  context->run();
+
+  ASSERT_EQ(executed.size(), kNumActions);
+  for (int i = 0; i < kNumActions; ++i) {
+    ASSERT_EQ(executed[i], i);
+  }
+}
+
+TEST(ContextTest, BoundedMailbox_RejectPolicy_ReportsRejectedActions)
+{
+  auto context = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  context->setCapacity(4, icc::OverflowPolicy::Reject);
+  auto channel = context->createChannel();
+  int executedCount = 0;
+  int rejectedCount = 0;
+  for (int i = 0; i < 10; ++i) {
+    if (channel->tryPush([&executedCount] {
+          ++executedCount;
+        }) == icc::PushResult::Rejected) {
+      ++rejectedCount;
+    }
+  }
+  context->setCapacity(0);
+  channel->push([context] {
+    context->stop();
+  });
+  context->run();
+
+  EXPECT_EQ(executedCount, 4);
+  EXPECT_EQ(rejectedCount, 6);
+}
+
+TEST(ContextTest, PingPong_WithSpinning_AllMessagesDelivered)
+{
+  auto pingContext = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  auto pongContext = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  pingContext->setSpinCount(1000);
+  pongContext->setSpinCount(1000);
+  std::shared_ptr<icc::IContext::IChannel> pingChannel = pingContext->createChannel();
+  std::shared_ptr<icc::IContext::IChannel> pongChannel = pongContext->createChannel();
+  const int kNumExchanges = 100000;
+  int numPongs = 0;
+  std::function<void(int)> ping;
+  ping = [&](int _count) {
+    if (_count == kNumExchanges) {
+      pongChannel->push([pongContext] {
+        pongContext->stop();
+      });
+      pingContext->stop();
+      return;
+    }
+    pongChannel->push([&, _count] {
+      ++numPongs;
+      pingChannel->push([&ping, _count] {
+        ping(_count + 1);
+      });
+    });
+  };
+  std::thread pongThread([pongContext] {
+    pongContext->run();
+  });
+  pingChannel->push([&ping] {
+    ping(0);
+  });
+  auto start = std::chrono::steady_clock::now();
+  pingContext->run();
+  pongThread.join();
+  auto duration = std::chrono::steady_clock::now() - start;
+
+  std::cout << "Round trip = "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / kNumExchanges
+            << " ns" << std::endl;
+  EXPECT_EQ(numPongs, kNumExchanges);
+}
+
+TEST(ContextTest, Stats_Enabled_CountersAndHistogramsAreCollected)
+{
+  auto context = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  auto channel = context->createChannel();
+  EXPECT_FALSE(context->stats().enabled_);
+
+  context->enableStats(true);
+  const int kNumActions = 100;
+  for (int i = 0; i < kNumActions; ++i) {
+    channel->push([] {
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    });
+  }
+  icc::ContextStats stats = context->stats();
+  EXPECT_TRUE(stats.enabled_);
+  EXPECT_EQ(stats.pushed_actions_, kNumActions);
+  EXPECT_EQ(stats.queue_depth_, kNumActions);
+  EXPECT_EQ(stats.max_queue_depth_, kNumActions);
+
+  channel->push([context] {
+    context->stop();
+  });
+  context->run();
+
+  stats = context->stats();
+  EXPECT_EQ(stats.executed_actions_, kNumActions + 1);
+  EXPECT_EQ(stats.queue_depth_, 0);
+  EXPECT_GE(stats.total_execution_time_, std::chrono::microseconds(10 * kNumActions));
+  EXPECT_GT(stats.actions_per_second_, 0.0);
+  std::uint64_t numMeasured = 0;
+  for (auto bucket : stats.execution_time_histogram_) {
+    numMeasured += bucket;
+  }
+  EXPECT_EQ(numMeasured, kNumActions + 1);
+}
+
+TEST(ContextTest, PushBatch_KeepsFifoOrderWithOtherPushes)
+{
+  auto context = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  auto channel = context->createChannel();
+  std::vector<int> executed;
+  channel->push([&executed] {
+    executed.push_back(0);
+  });
+  std::vector<icc::Action> batch;
+  for (int i = 1; i <= 10; ++i) {
+    batch.emplace_back([&executed, i] {
+      executed.push_back(i);
+    });
+  }
+  channel->pushBatch(std::move(batch));
+  channel->push([&executed] {
+    executed.push_back(11);
+  });
+  channel->push([context] {
+    context->stop();
+  });
+  context->run();
+
+  std::vector<int> expected;
+  for (int i = 0; i <= 11; ++i) {
+    expected.push_back(i);
+  }
+  EXPECT_EQ(executed, expected);
+}
+
+TEST(ContextTest, DeadlineContext_EarliestDeadlineFirst_ExpiredAreHandled)
+{
+  auto context = icc::ContextBuilder::createContext<icc::DeadlineQueueAction>();
+  std::vector<int> expired;
+  context->setExpiryPolicy(icc::ExpiryPolicy::Handle, [&expired](icc::Action) {
+    expired.push_back(0);
+  });
+  auto channel = context->createChannel();
+  const auto kNow = std::chrono::steady_clock::now();
+  std::vector<int> executed;
+  channel->push([&executed] {
+    executed.push_back(4);
+  });
+  channel->push([&executed] {
+    executed.push_back(3);
+  }, kNow + std::chrono::hours(3));
+  channel->push([&executed] {
+    executed.push_back(1);
+  }, kNow + std::chrono::hours(1));
+  channel->push([&executed] {
+    executed.push_back(2);
+  }, kNow + std::chrono::hours(2));
+  channel->push([&executed] {
+    executed.push_back(-1);
+  }, kNow - std::chrono::seconds(1));
+  channel->push([context] {
+    context->stop();
+  });
+  context->run();
+
+  EXPECT_EQ(executed, std::vector<int>({1, 2, 3, 4}));
+  EXPECT_EQ(expired.size(), 1);
+  EXPECT_EQ(context->expiredCount(), 1);
+}
+
+TEST(ContextTest, Timers_DelayedAndPeriodicActions_AreExecutedUntilCancelled)
+{
+  auto context = icc::ContextBuilder::createContext<icc::ThreadSafeQueueAction>();
+  auto channel = context->createChannel();
+  std::vector<int> executed;
+  int numTicks = 0;
+  icc::TimerHandle ticker;
+  std::thread producer([&] {
+    channel->pushAfter(std::chrono::milliseconds(30), [&executed] {
+      executed.push_back(2);
+    });
+    channel->pushAfter(std::chrono::milliseconds(10), [&executed] {
+      executed.push_back(1);
+    });
+    auto cancelled = channel->pushAfter(std::chrono::milliseconds(20), [&executed] {
+      executed.push_back(-1);
+    });
+    cancelled.cancel();
+    ticker = channel->pushEvery(std::chrono::milliseconds(5), [&numTicks, &ticker] {
+      if (++numTicks == 3) {
+        ticker.cancel();
+      }
+    });
+    channel->pushAt(icc::TimerClock::now() + std::chrono::milliseconds(60), [context] {
+      context->stop();
+    });
+  });
+  producer.join();
+  context->run();
+
+  EXPECT_EQ(executed, std::vector<int>({1, 2}));
+  EXPECT_EQ(numTicks, 3);
+  EXPECT_TRUE(ticker.isCancelled());
+}
+
+TEST(ContextTest, DeadlineContext_Timers_AreExecutedWithoutExpiry)
+{
+  auto context = icc::ContextBuilder::createContext<icc::DeadlineQueueAction>();
+  context->setExpiryPolicy(icc::ExpiryPolicy::Drop);
+  auto channel = context->createChannel();
+  std::vector<int> executed;
+  int numTicks = 0;
+  icc::TimerHandle ticker;
+  std::thread producer([&] {
+    channel->pushAfter(std::chrono::milliseconds(20), [&executed] {
+      executed.push_back(2);
+    });
+    channel->pushAfter(std::chrono::milliseconds(10), [&executed] {
+      executed.push_back(1);
+    });
+    ticker = channel->pushEvery(std::chrono::milliseconds(5), [&numTicks, &ticker] {
+      if (++numTicks == 3) {
+        ticker.cancel();
+      }
+    });
+    channel->pushAt(icc::TimerClock::now() + std::chrono::milliseconds(50), [context] {
+      context->stop();
+    });
+  });
+  producer.join();
+  context->run();
+
+  EXPECT_EQ(executed, std::vector<int>({1, 2}));
+  EXPECT_EQ(numTicks, 3);
+  EXPECT_EQ(context->expiredCount(), 0u);
+}
+
+TEST(ContextTest, DeadlineContext_ContinuousDeadlineLoad_DoesNotStarveOtherActions)
+{
+  auto context = icc::ContextBuilder::createContext<icc::DeadlineQueueAction>();
+  auto channel = context->createChannel();
+  std::atomic<bool> isPlainExecuted{false};
+  std::atomic<bool> isHighExecuted{false};
+  std::atomic<bool> isTimerExecuted{false};
+  std::function<void()> load;
+  load = [&] {
+    if (isPlainExecuted && isHighExecuted && isTimerExecuted) {
+      context->stop();
+      return;
+    }
+    channel->push([&load] {
+      load();
+    }, std::chrono::steady_clock::now() + std::chrono::hours(1));
+  };
+  const int kNumLoadActions = 8;
+  for (int i = 0; i < kNumLoadActions; ++i) {
+    load();
+  }
+  std::thread producer([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    channel->push([&isPlainExecuted] {
+      isPlainExecuted = true;
+    });
+    channel->push([&isHighExecuted] {
+      isHighExecuted = true;
+    }, icc::Priority::High);
+    channel->pushAfter(std::chrono::milliseconds(10), [&isTimerExecuted] {
+      isTimerExecuted = true;
+    });
+  });
+  context->run();
+  producer.join();
+
+  EXPECT_TRUE(isPlainExecuted);
+  EXPECT_TRUE(isHighExecuted);
+  EXPECT_TRUE(isTimerExecuted);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file MpscQueueTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for MpscQueue class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <icc/Context.hpp>
+#include <icc/_private/containers/MpscQueue.hpp>
+
+template <typename TItem>
+using MpscQueue = icc::_private::containers::MpscQueue<TItem>;
+
+struct MpscQueueIntTest : testing::Test
+{
+  std::atomic_uint write_count{0};
+  std::atomic_uint read_count{0};
+  std::shared_ptr<MpscQueue<int>> queue;
+  long long max_items = 0;
+  long long num_write_threads = 0;
+
+  virtual void SetUp() {
+    write_count.store(0);
+    read_count.store(0);
+    queue = std::make_shared<MpscQueue<int>>();
+  };
+
+  virtual void TearDown() {
+    queue.reset();
+    write_count.store(0);
+    read_count.store(0);
+  }
+
+  void writeQueue() {
+    for (int i = 0; i < max_items; ++i) {
+      queue->push(i);
+      write_count++;
+    }
+  }
+
+  void readQueue() {
+    while (read_count.load() < num_write_threads * max_items) {
+      queue->waitPop();
+      read_count.fetch_add(1);
+    }
+  }
+};
+
+TEST_F(MpscQueueIntTest, TenMillionItems_OneReadThread_TenWriteThreads)
+{
+  max_items = 1000000;
+  num_write_threads = 10;
+
+  clock_t tStart = clock();
+
+  std::thread readThread(&MpscQueueIntTest::readQueue, this);
+
+  std::vector<std::thread> writeThreads;
+  for (int i = 0; i < num_write_threads; ++i) {
+    writeThreads.emplace_back(&MpscQueueIntTest::writeQueue, this);
+  }
+
+  for (int i = 0; i < num_write_threads; ++i) {
+    writeThreads[i].join();
+  }
+  readThread.join();
+
+  printf("Time taken: %.2fs\n", static_cast<double>(clock() - tStart) / CLOCKS_PER_SEC);
+
+  std::cout << "Write data = " << write_count.load() << std::endl;
+  std::cout << "Read data = " << read_count.load() << std::endl;
+
+  EXPECT_EQ(write_count, read_count);
+  EXPECT_TRUE(queue->empty());
+}
+
+TEST(MpscQueueContextTest, ActionsFromManyChannels_ExecutedInOrderPerChannel)
+{
+  auto context = icc::ContextBuilder::createContext<icc::MpscQueueAction>();
+  auto stopChannel = context->createChannel();
+  std::thread contextThread([context] {
+    context->run();
+  });
+  const int kNumChannels = 4;
+  const int kNumActions = 10000;
+  std::vector<int> lastValues(kNumChannels, -1);
+  std::atomic<bool> inOrder{true};
+  std::vector<std::thread> producers;
+  for (int channelIdx = 0; channelIdx < kNumChannels; ++channelIdx) {
+    std::shared_ptr<icc::IContext::IChannel> channel = context->createChannel();
+    producers.emplace_back([=, &lastValues, &inOrder] {
+      for (int i = 0; i < kNumActions; ++i) {
+        channel->push([=, &lastValues, &inOrder] {
+          if (lastValues[channelIdx] + 1 != i) {
+            inOrder.store(false);
+          }
+          lastValues[channelIdx] = i;
+        });
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  stopChannel->push([context] {
+    context->stop();
+  });
+  contextThread.join();
+
+  EXPECT_TRUE(inOrder.load());
+  for (int channelIdx = 0; channelIdx < kNumChannels; ++channelIdx) {
+    EXPECT_EQ(lastValues[channelIdx], kNumActions - 1);
+  }
+}
+
+TEST(MpscQueueBatchTest, PushBatch_ItemsArePoppedInOrder)
+{
+  MpscQueue<int> queue;
+  queue.push(0);
+  std::vector<int> batch = {1, 2, 3, 4};
+  queue.pushBatch(batch.begin(), batch.end());
+  queue.push(5);
+  for (int i = 0; i <= 5; ++i) {
+    EXPECT_EQ(queue.pop(), i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
@@ -9,6 +9,9 @@
 #include <gtest/gtest.h>
 #include <atomic>
 #include <thread>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
 #include <icc/_private/containers/ThreadSafeQueue.hpp>
 
 template <typename TItem>
@@ -82,6 +85,7 @@ TEST_F(ThreadSafeQueueIntTest, TenMillionItems_TenReadThreads_OneWriteThread)
 
   std::cout << "Write data = " << write_count.load() << std::endl;
   std::cout << "Read data = " << read_count.load() << std::endl;
+  std::cout << "Allocated nodes = " << queue->allocations() << std::endl;
 
   EXPECT_EQ(write_count, read_count);
 }
@@ -116,6 +120,7 @@ TEST_F(ThreadSafeQueueIntTest, TenMillionItems_OneReadThread_TenWriteThreads)
 
   std::cout << "Write data = " << write_count.load() << std::endl;
   std::cout << "Read data = " << read_count.load() << std::endl;
+  std::cout << "Allocated nodes = " << queue->allocations() << std::endl;
 
   EXPECT_EQ(write_count, read_count);
 }
@@ -150,6 +155,7 @@ TEST_F(ThreadSafeQueueIntTest, TenMillionItems_FiveReadThreads_TenWriteThreads)
 
   std::cout << "Write data = " << write_count.load() << std::endl;
   std::cout << "Read data = " << read_count.load() << std::endl;
+  std::cout << "Allocated nodes = " << queue->allocations() << std::endl;
 
   EXPECT_EQ(write_count, read_count);
 }
@@ -184,6 +190,312 @@ TEST_F(ThreadSafeQueueIntTest, TenMillionItems_TenReadThreads_FiveWriteThreads)
 
   std::cout << "Write data = " << write_count.load() << std::endl;
   std::cout << "Read data = " << read_count.load() << std::endl;
+  std::cout << "Allocated nodes = " << queue->allocations() << std::endl;
 
   EXPECT_EQ(write_count, read_count);
 }
+
+TEST_F(ThreadSafeQueueIntTest, OneMillionItems_ReservedQueue_NoAllocations)
+{
+  const unsigned kReservedNodes = 1024;
+  queue = std::make_shared<ThreadSafeQueue<int>>(kReservedNodes);
+  ASSERT_EQ(queue->allocations(), kReservedNodes);
+
+  for (int round = 0; round < 1000; ++round) {
+    for (unsigned i = 0; i < kReservedNodes; ++i) {
+      queue->push(static_cast<int>(i));
+    }
+    int it;
+    while (queue->tryPop(it)) {
+      read_count.fetch_add(1);
+    }
+  }
+
+  std::cout << "Read data = " << read_count.load() << std::endl;
+  std::cout << "Allocated nodes = " << queue->allocations() << std::endl;
+
+  EXPECT_EQ(read_count.load(), 1000 * kReservedNodes);
+  EXPECT_EQ(queue->allocations(), kReservedNodes);
+}
+
+TEST_F(ThreadSafeQueueIntTest, OneMillionItems_ThreadCache_NoAllocationsInSteadyState)
+{
+  queue = std::make_shared<ThreadSafeQueue<int>>(0, true);
+  for (int round = 0; round < 1000000; ++round) {
+    queue->push(round);
+    int it;
+    if (queue->tryPop(it)) {
+      read_count.fetch_add(1);
+    }
+  }
+
+  std::cout << "Read data = " << read_count.load() << std::endl;
+  std::cout << "Allocated nodes = " << queue->allocations() << std::endl;
+
+  EXPECT_EQ(read_count.load(), 1000000u);
+  EXPECT_LE(queue->allocations(), 1u);
+}
+
+TEST_F(ThreadSafeQueueIntTest, ThreadCache_NodesDoNotMoveBetweenQueues)
+{
+  queue = std::make_shared<ThreadSafeQueue<int>>(0, true);
+  auto otherQueue = std::make_shared<ThreadSafeQueue<int>>(0, true);
+  for (int round = 0; round < 1000; ++round) {
+    queue->push(round);
+    otherQueue->push(round);
+    int it;
+    EXPECT_TRUE(queue->tryPop(it));
+    EXPECT_TRUE(otherQueue->tryPop(it));
+  }
+
+  // NOTE(redra): Each queue pushes into nodes it allocated itself
+  EXPECT_GE(queue->allocations(), 1u);
+  EXPECT_GE(otherQueue->allocations(), 1u);
+  otherQueue.reset();
+  for (int round = 0; round < 1000; ++round) {
+    queue->push(round);
+    int it;
+    EXPECT_TRUE(queue->tryPop(it));
+  }
+  const std::size_t kAllocations = queue->allocations();
+  for (int round = 0; round < 1000; ++round) {
+    queue->push(round);
+    int it;
+    EXPECT_TRUE(queue->tryPop(it));
+  }
+  EXPECT_EQ(queue->allocations(), kAllocations);
+}
+
+TEST_F(ThreadSafeQueueIntTest, Drain_HandlerStops_NotHandledItemsStayInQueue)
+{
+  for (int i = 0; i < 10; ++i) {
+    queue->push(i);
+  }
+
+  std::vector<int> handled;
+  auto handledCount = queue->waitDrain([&handled](int _item) {
+    handled.push_back(_item);
+    return _item < 3;
+  }, 8);
+
+  EXPECT_EQ(handledCount, 4u);
+  EXPECT_EQ(handled, std::vector<int>({0, 1, 2, 3}));
+  ASSERT_EQ(queue->count(), 6u);
+  EXPECT_EQ(queue->pop(), 4);
+
+  handledCount = queue->waitDrain([](int) {
+    return true;
+  }, 0);
+  EXPECT_EQ(handledCount, 5u);
+  EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(ThreadSafeQueueIntTest, Bounded_OverflowPolicies_AppliedWhenFull)
+{
+  using icc::_private::containers::OverflowPolicy;
+  using icc::_private::containers::PushResult;
+
+  queue->setCapacity(2, OverflowPolicy::Reject);
+  EXPECT_EQ(queue->push(1), PushResult::Pushed);
+  EXPECT_EQ(queue->push(2), PushResult::Pushed);
+  EXPECT_EQ(queue->push(3), PushResult::Rejected);
+
+  queue->setCapacity(2, OverflowPolicy::DropNewest);
+  EXPECT_EQ(queue->push(3), PushResult::DroppedNewest);
+
+  queue->setCapacity(2, OverflowPolicy::DropOldest);
+  EXPECT_EQ(queue->push(3), PushResult::DroppedOldest);
+  ASSERT_EQ(queue->count(), 2u);
+  EXPECT_EQ(queue->pop(), 2);
+  EXPECT_EQ(queue->pop(), 3);
+}
+
+TEST_F(ThreadSafeQueueIntTest, Bounded_DropOldest_ItemIsNotDefaultConstructible)
+{
+  using icc::_private::containers::OverflowPolicy;
+  using icc::_private::containers::PushResult;
+  struct Item {
+    explicit Item(int _value)
+      : value_(_value) {
+    }
+    int value_;
+  };
+
+  ThreadSafeQueue<Item> itemQueue;
+  itemQueue.setCapacity(1, OverflowPolicy::DropOldest);
+  EXPECT_EQ(itemQueue.tryPush(Item{1}), PushResult::Pushed);
+  EXPECT_EQ(itemQueue.tryPush(Item{2}), PushResult::DroppedOldest);
+  EXPECT_EQ(itemQueue.count(), 1u);
+}
+
+TEST_F(ThreadSafeQueueIntTest, Bounded_DropOldest_HighItemsAreNotLost)
+{
+  using icc::_private::containers::OverflowPolicy;
+  using icc::_private::containers::Priority;
+  using icc::_private::containers::PushResult;
+
+  queue->setCapacity(2, OverflowPolicy::DropOldest);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(queue->push(i, Priority::High), PushResult::Pushed);
+  }
+  EXPECT_EQ(queue->push(10, Priority::Normal), PushResult::DroppedNewest);
+  EXPECT_EQ(queue->push(20, Priority::Low), PushResult::DroppedNewest);
+  ASSERT_EQ(queue->count(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(queue->pop(), i);
+  }
+
+  queue->push(10, Priority::Normal);
+  queue->push(11, Priority::Normal);
+  EXPECT_EQ(queue->push(20, Priority::Low), PushResult::DroppedNewest);
+  EXPECT_EQ(queue->push(12, Priority::Normal), PushResult::DroppedOldest);
+  EXPECT_EQ(queue->pop(), 11);
+  EXPECT_EQ(queue->pop(), 12);
+}
+
+TEST_F(ThreadSafeQueueIntTest, ThrowingItemMove_NodesAreReusedAndBatchIsPublished)
+{
+  struct Item {
+    Item() = default;
+    Item(int _value, bool _throwOnMove)
+      : value_(_value)
+      , throw_on_move_(_throwOnMove) {
+    }
+    Item(Item &&_other)
+      : value_(_other.value_) {
+      if (_other.throw_on_move_) {
+        throw std::runtime_error("Move of item");
+      }
+    }
+    Item &operator=(Item &&_other) {
+      value_ = _other.value_;
+      return *this;
+    }
+    int value_ = 0;
+    bool throw_on_move_ = false;
+  };
+
+  ThreadSafeQueue<Item> itemQueue;
+  EXPECT_THROW(itemQueue.tryPush(Item{1, true}), std::runtime_error);
+  EXPECT_EQ(itemQueue.count(), 0u);
+  EXPECT_EQ(itemQueue.allocations(), 1u);
+  itemQueue.push(Item{2, false});
+  EXPECT_EQ(itemQueue.allocations(), 1u);
+  EXPECT_EQ(itemQueue.pop().value_, 2);
+
+  std::vector<Item> items;
+  items.emplace_back(3, false);
+  items.emplace_back(4, false);
+  items.emplace_back(5, true);
+  items.emplace_back(6, false);
+  EXPECT_THROW(itemQueue.pushBatch(items.begin(), items.end()), std::runtime_error);
+  ASSERT_EQ(itemQueue.count(), 2u);
+  EXPECT_EQ(itemQueue.allocations(), 3u);
+  itemQueue.push(Item{7, false});
+  EXPECT_EQ(itemQueue.allocations(), 3u);
+  EXPECT_EQ(itemQueue.pop().value_, 3);
+  EXPECT_EQ(itemQueue.pop().value_, 4);
+  EXPECT_EQ(itemQueue.pop().value_, 7);
+}
+
+TEST_F(ThreadSafeQueueIntTest, Watermarks_ThrowingCallback_IsPropagated)
+{
+  queue->setWatermarks(1, 0, [] {
+    throw std::runtime_error("High watermark");
+  }, nullptr);
+  EXPECT_THROW(queue->tryPush(1), std::runtime_error);
+  EXPECT_EQ(queue->count(), 1u);
+}
+
+TEST_F(ThreadSafeQueueIntTest, Bounded_BlockedProducer_ResumedAfterPop)
+{
+  queue->setCapacity(1);
+  queue->push(1);
+  std::atomic<bool> isPushed{false};
+  std::thread producer([this, &isPushed] {
+    queue->push(2);
+    isPushed.store(true);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(isPushed.load());
+  EXPECT_EQ(queue->pop(), 1);
+  producer.join();
+  EXPECT_TRUE(isPushed.load());
+  EXPECT_EQ(queue->pop(), 2);
+}
+
+TEST_F(ThreadSafeQueueIntTest, Watermarks_CallbacksCalledOncePerCrossing)
+{
+  int highCount = 0;
+  int lowCount = 0;
+  queue->setWatermarks(3, 1, [&highCount] {
+    ++highCount;
+  }, [&lowCount] {
+    ++lowCount;
+  });
+  for (int i = 0; i < 5; ++i) {
+    queue->push(i);
+  }
+  EXPECT_EQ(highCount, 1);
+  EXPECT_EQ(lowCount, 0);
+  for (int i = 0; i < 4; ++i) {
+    queue->pop();
+  }
+  EXPECT_EQ(highCount, 1);
+  EXPECT_EQ(lowCount, 1);
+}
+
+TEST_F(ThreadSafeQueueIntTest, PriorityLanes_HigherPriorityPoppedFirst)
+{
+  using icc::_private::containers::Priority;
+
+  queue->push(1, Priority::Low);
+  queue->push(2, Priority::Normal);
+  queue->push(3, Priority::High);
+  queue->push(4, Priority::Normal);
+  queue->push(5, Priority::High);
+
+  std::vector<int> popped;
+  while (!queue->empty()) {
+    popped.push_back(queue->pop());
+  }
+  EXPECT_EQ(popped, std::vector<int>({3, 5, 2, 4, 1}));
+}
+
+TEST_F(ThreadSafeQueueIntTest, PriorityLanes_LowLaneIsNotStarved)
+{
+  using icc::_private::containers::Priority;
+  const unsigned kStarvationLimit = ThreadSafeQueue<int>::kStarvationLimit;
+
+  queue->push(-1, Priority::Low);
+  for (unsigned i = 0; i < 2 * kStarvationLimit; ++i) {
+    queue->push(static_cast<int>(i), Priority::High);
+  }
+
+  unsigned numHighBeforeLow = 0;
+  while (queue->pop() != -1) {
+    ++numHighBeforeLow;
+  }
+  EXPECT_EQ(numHighBeforeLow, kStarvationLimit);
+}
+
+TEST_F(ThreadSafeQueueIntTest, PriorityLanes_NormalLaneIsNotStarvedByHighAndLow)
+{
+  using icc::_private::containers::Priority;
+  const unsigned kStarvationLimit = ThreadSafeQueue<int>::kStarvationLimit;
+  const unsigned kNumItems = 10 * kStarvationLimit;
+
+  for (unsigned i = 0; i < kNumItems; ++i) {
+    queue->push(0, Priority::High);
+    queue->push(1, Priority::Normal);
+    queue->push(2, Priority::Low);
+  }
+
+  unsigned numPopped[3] = {};
+  for (unsigned i = 0; i < 4 * kStarvationLimit; ++i) {
+    ++numPopped[queue->pop()];
+  }
+  EXPECT_GE(numPopped[1], 2u);
+  EXPECT_GE(numPopped[2], 2u);
+  EXPECT_GT(numPopped[0], numPopped[1] + numPopped[2]);
+}
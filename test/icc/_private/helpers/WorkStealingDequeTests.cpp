@@ -0,0 +1,31 @@
+/**
+ * @file WorkStealingDequeTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for WorkStealingDeque class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <icc/_private/containers/WorkStealingDeque.hpp>
+
+template <typename TItem>
+using WorkStealingDeque = icc::_private::containers::WorkStealingDeque<TItem>;
+
+TEST(WorkStealingDequeTest, CapacityIsNotPowerOfTwo_ItemsAreNotLost)
+{
+  WorkStealingDeque<int> deque{3};
+  std::vector<int> items{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  for (auto &item : items) {
+    deque.push(&item);
+  }
+
+  EXPECT_EQ(deque.steal(), &items[0]);
+  EXPECT_EQ(deque.steal(), &items[1]);
+  for (auto i = items.size() - 1; i >= 2; --i) {
+    EXPECT_EQ(deque.pop(), &items[i]);
+  }
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+}
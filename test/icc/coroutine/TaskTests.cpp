@@ -0,0 +1,207 @@
+/**
+ * @file TaskTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for coroutine Task class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+
+#if defined(__cpp_lib_coroutine)
+
+#include <fstream>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <icc/Context.hpp>
+#include <icc/coroutine/FramePool.hpp>
+#include <icc/coroutine/Task.hpp>
+#include <icc/coroutine/TaskScheduler.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+icc::coroutine::Task<int> value(int _value) {
+  co_return _value;
+}
+
+icc::coroutine::Task<long> sumOfValues(int _count) {
+  long sum = 0;
+  for (int i = 0; i < _count; ++i) {
+    sum += co_await value(i);
+  }
+  co_return sum;
+}
+
+icc::coroutine::Task<int> awaitFuture(std::future<int> _future) {
+  co_return co_await std::move(_future);
+}
+
+icc::coroutine::Task<int> depthOfCalls(int _depth, std::shared_future<int> _leaf) {
+  if (_depth == 0) {
+    co_return co_await std::move(_leaf);
+  }
+  co_return 1 + co_await depthOfCalls(_depth - 1, _leaf);
+}
+
+icc::coroutine::Task<int> failure(int _value) {
+  if (_value != 0) {
+    throw std::runtime_error("Task failed");
+  }
+  co_return _value;
+}
+
+icc::coroutine::Task<int> catchFailure(int _value) {
+  try {
+    co_return co_await failure(_value);
+  } catch (const std::runtime_error &) {
+    co_return -1;
+  }
+}
+
+std::size_t numOfThreads() {
+#if defined(__linux__)
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("Threads:", 0) == 0) {
+      return std::stoul(line.substr(8));
+    }
+  }
+#endif
+  return 0;
+}
+
+}
+
+TEST(CoroutineTaskTest, AwaitChainOfTasks_Success)
+{
+  const int kNumAwaits = 100000;
+  auto context = std::make_shared<icc::ThreadSafeQueueContext>();
+  auto task = sumOfValues(kNumAwaits);
+  {
+    auto scheduler = std::make_shared<icc::coroutine::TaskScheduler>(context->createChannel());
+    scheduler->startCoroutine(task);
+  }
+  context->run(icc::ExecPolicy::UntilWorkers);
+
+  ASSERT_TRUE(task.isReady());
+  EXPECT_EQ(task.get(), static_cast<long>(kNumAwaits) * (kNumAwaits - 1) / 2);
+}
+
+TEST(CoroutineTaskTest, AwaitFutures_NoThreadPerAwait)
+{
+  const int kNumCoroutines = 100;
+  auto context = std::make_shared<icc::ThreadSafeQueueContext>();
+  std::vector<std::promise<int>> promises(kNumCoroutines);
+  std::vector<icc::coroutine::Task<int>> tasks;
+  {
+    auto scheduler = std::make_shared<icc::coroutine::TaskScheduler>(context->createChannel());
+    for (auto &promise : promises) {
+      tasks.push_back(awaitFuture(promise.get_future()));
+      scheduler->startCoroutine(tasks.back());
+    }
+  }
+  const std::size_t kNumThreads = numOfThreads();
+  std::thread runner([context] {
+    context->run(icc::ExecPolicy::UntilWorkers);
+  });
+  std::this_thread::sleep_for(50ms);
+  // NOTE(redra): Runner and shared reactor of futures
+  EXPECT_LE(numOfThreads(), kNumThreads + 2);
+  for (int i = 0; i < kNumCoroutines; ++i) {
+    promises[i].set_value(i);
+  }
+  runner.join();
+
+  int sum = 0;
+  for (auto &task : tasks) {
+    sum += task.get();
+  }
+  EXPECT_EQ(sum, kNumCoroutines * (kNumCoroutines - 1) / 2);
+}
+
+TEST(CoroutineTaskTest, AwaitDeepChainOfTasks_NoQueueHops)
+{
+  const int kDepth = 10000;
+  auto context = std::make_shared<icc::ThreadSafeQueueContext>();
+  context->enableStats(true);
+  std::promise<int> leaf;
+  auto task = depthOfCalls(kDepth, leaf.get_future().share());
+  {
+    auto scheduler = std::make_shared<icc::coroutine::TaskScheduler>(context->createChannel());
+    scheduler->startCoroutine(task);
+  }
+  std::thread runner([context] {
+    context->run(icc::ExecPolicy::UntilWorkers);
+  });
+  leaf.set_value(0);
+  runner.join();
+
+  ASSERT_TRUE(task.isReady());
+  EXPECT_EQ(task.get(), kDepth);
+  // NOTE(redra): Start of coroutine and resumption of leaf after future
+  EXPECT_LE(context->stats().executed_actions_, 2u);
+}
+
+TEST(CoroutineTaskTest, ExceptionInTask_IsRethrownToAwaiterAndGet)
+{
+  auto context = std::make_shared<icc::ThreadSafeQueueContext>();
+  auto caught = catchFailure(1);
+  auto failed = failure(1);
+  {
+    auto scheduler = std::make_shared<icc::coroutine::TaskScheduler>(context->createChannel());
+    scheduler->startCoroutine(caught);
+    scheduler->startCoroutine(failed);
+  }
+  context->run(icc::ExecPolicy::UntilWorkers);
+
+  ASSERT_TRUE(caught.isReady());
+  EXPECT_EQ(caught.get(), -1);
+  ASSERT_TRUE(failed.isReady());
+  EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST(CoroutineTaskTest, FramePool_ReusesFramesReleasedOnAnyThread)
+{
+  using icc::coroutine::FramePool;
+  std::vector<void *> frames;
+  // NOTE(redra): Separate thread starts with empty pool
+  std::thread owner([&frames] {
+    void *frame = FramePool::allocate(100);
+    FramePool::deallocate(frame);
+    EXPECT_EQ(frame, FramePool::allocate(100));
+
+    std::thread releaser([frame] {
+      FramePool::deallocate(frame);
+    });
+    releaser.join();
+    EXPECT_EQ(frame, FramePool::allocate(100));
+    FramePool::deallocate(frame);
+
+    void *oversized = FramePool::allocate(FramePool::kMaxBlockSize);
+    FramePool::deallocate(oversized);
+
+    for (int i = 0; i < 10; ++i) {
+      frames.push_back(FramePool::allocate(1000));
+    }
+  });
+  owner.join();
+  // NOTE(redra): Frames outlive thread that allocated them
+  for (void *frame : frames) {
+    FramePool::deallocate(frame);
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * @file EventLoopContextTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for Context<os::EventLoop> class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <icc/os/EventLoopContext.hpp>
+
+TEST(EventLoopContextTest, Actions_AreExecutedOnEventLoopThread)
+{
+  auto context = icc::ContextBuilder::createContext(icc::os::EventLoop::createEventLoop());
+  auto channel = context->createChannel();
+  // NOTE(redra): Action pushed before run is executed in the first loop iteration
+  std::promise<std::thread::id> pushedBeforeRun;
+  auto pushedBeforeRunFuture = pushedBeforeRun.get_future();
+  channel->push([&pushedBeforeRun] {
+    pushedBeforeRun.set_value(std::this_thread::get_id());
+  });
+  std::thread loopThread([context] {
+    context->run();
+  });
+
+  std::promise<bool> invokedInline;
+  auto invokedInlineFuture = invokedInline.get_future();
+  channel->push([&channel, &invokedInline] {
+    bool isInline = false;
+    channel->invoke([&isInline] {
+      isInline = true;
+    });
+    invokedInline.set_value(isInline);
+  });
+
+  EXPECT_EQ(pushedBeforeRunFuture.get(), loopThread.get_id());
+  EXPECT_TRUE(invokedInlineFuture.get());
+  EXPECT_EQ(context->getThreadId(), loopThread.get_id());
+
+  context->stop();
+  loopThread.join();
+  EXPECT_FALSE(context->isRun());
+}
+
+TEST(EventLoopContextTest, Timers_DelayedAndPeriodicActions_AreExecutedOnEventLoopThread)
+{
+  auto context = icc::ContextBuilder::createContext(icc::os::EventLoop::createEventLoop());
+  auto channel = context->createChannel();
+  std::vector<int> executed;
+  int numTicks = 0;
+  icc::TimerHandle ticker;
+  channel->pushAfter(std::chrono::milliseconds(30), [&executed] {
+    executed.push_back(2);
+  });
+  channel->pushAfter(std::chrono::milliseconds(10), [&executed] {
+    executed.push_back(1);
+  });
+  auto cancelled = channel->pushAfter(std::chrono::milliseconds(20), [&executed] {
+    executed.push_back(-1);
+  });
+  cancelled.cancel();
+  ticker = channel->pushEvery(std::chrono::milliseconds(5), [&numTicks, &ticker] {
+    if (++numTicks == 3) {
+      ticker.cancel();
+    }
+  });
+  channel->pushAt(icc::TimerClock::now() + std::chrono::milliseconds(60), [context] {
+    context->stop();
+  });
+  context->run();
+
+  EXPECT_EQ(executed, std::vector<int>({1, 2}));
+  EXPECT_EQ(numTicks, 3);
+}
+
+TEST(EventLoopContextTest, ContextDestroyed_ArmedTimer_DoesNotCallIt)
+{
+  auto eventLoop = icc::os::EventLoop::createEventLoop();
+  auto context = icc::ContextBuilder::createContext(eventLoop);
+  auto channel = context->createChannel();
+  std::atomic<bool> isExecuted{false};
+  channel->pushAfter(std::chrono::milliseconds(20), [&isExecuted] {
+    isExecuted = true;
+  });
+  std::promise<void> timerArmed;
+  channel->push([&timerArmed] {
+    timerArmed.set_value();
+  });
+  std::thread loopThread([eventLoop] {
+    eventLoop->run();
+  });
+  timerArmed.get_future().wait();
+  channel.reset();
+  context.reset();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  eventLoop->push([eventLoop] {
+    eventLoop->stop();
+  });
+  loopThread.join();
+  EXPECT_FALSE(isExecuted);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file ParallelTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for parallel algorithms on ThreadPool
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <icc/threadpool/Parallel.hpp>
+
+TEST(ParallelTest, ForTransformReduceSort_MatchSerialAlgorithms)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(4);
+  const int kSize = 100003;
+
+  std::vector<std::atomic<int>> visited(kSize);
+  icc::threadpool::parallelFor(*threadPool, 0, kSize, [&visited](int _idx) {
+    visited[_idx].fetch_add(1);
+  });
+  EXPECT_TRUE(std::all_of(visited.begin(), visited.end(), [](const std::atomic<int> &_count) {
+    return _count.load() == 1;
+  }));
+
+  std::vector<long long> values(kSize);
+  std::iota(values.begin(), values.end(), 0);
+  std::vector<long long> squares(kSize);
+  icc::threadpool::parallelTransform(*threadPool, values.begin(), values.end(), squares.begin(),
+  [](long long _value) {
+    return _value * _value;
+  });
+  EXPECT_EQ(squares[kSize - 1], static_cast<long long>(kSize - 1) * (kSize - 1));
+
+  const long long kSum = icc::threadpool::parallelReduce(*threadPool, values.begin(), values.end(),
+                                                         0LL, std::plus<long long>());
+  EXPECT_EQ(kSum, std::accumulate(values.begin(), values.end(), 0LL));
+
+  std::mt19937 generator{42};
+  std::shuffle(values.begin(), values.end(), generator);
+  icc::threadpool::parallelSort(*threadPool, values.begin(), values.end());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+  EXPECT_EQ(values.front(), 0);
+  EXPECT_EQ(values.back(), kSize - 1);
+}
+
+TEST(ParallelTest, ExceptionInChunk_IsRethrownInCallingThread)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(2);
+  EXPECT_THROW(icc::threadpool::parallelFor(*threadPool, 0, 1000, 1, [](int _idx) {
+    if (_idx == 500) {
+      throw std::runtime_error("Chunk failed");
+    }
+  }), std::runtime_error);
+}
+
+TEST(ParallelTest, PushOfHelperFails_ChunksAreExecutedByCallingThread)
+{
+  // NOTE(redra): Pool that accepts the first helper and fails to push the rest
+  struct FailingPool {
+    std::size_t size() const {
+      return 4;
+    }
+
+    void push(icc::Action _task) {
+      if (num_pushed_++ > 0) {
+        throw std::bad_alloc();
+      }
+      pool_->push(std::move(_task));
+    }
+
+    std::shared_ptr<icc::threadpool::ThreadPool> pool_;
+    std::size_t num_pushed_;
+  };
+  FailingPool pool{icc::threadpool::ThreadPool::createPool(1), 0};
+  const std::size_t kSize = 10000;
+  std::vector<std::atomic<int>> visited(kSize);
+  icc::helpers::ChunkedLoop::run(pool, kSize, 1,
+  [&visited](std::size_t _begin, std::size_t _end, std::size_t) {
+    for (std::size_t i = _begin; i < _end; ++i) {
+      visited[i].fetch_add(1);
+    }
+  });
+
+  EXPECT_EQ(pool.num_pushed_, 2u);
+  EXPECT_TRUE(std::all_of(visited.begin(), visited.end(), [](const std::atomic<int> &_count) {
+    return _count.load() == 1;
+  }));
+}
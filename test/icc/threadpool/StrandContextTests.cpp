@@ -0,0 +1,107 @@
+/**
+ * @file StrandContextTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for StrandContext class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include <icc/threadpool/StrandContext.hpp>
+
+TEST(StrandContextTest, ManyStrands_ActionsOfEachStrandAreSerial)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(4);
+  const int kNumStrands = 100;
+  const int kNumActions = 1000;
+  std::vector<std::shared_ptr<icc::StrandContext>> strands;
+  std::vector<int> counters(kNumStrands, 0);
+  std::vector<std::unique_ptr<std::atomic<bool>>> isExecuting;
+  std::atomic<bool> isSerial{true};
+  std::atomic<int> numExecuted{0};
+  std::promise<void> allExecuted;
+  auto allExecutedFuture = allExecuted.get_future();
+  for (int i = 0; i < kNumStrands; ++i) {
+    strands.push_back(icc::ContextBuilder::createContext(threadPool));
+    strands.back()->setMaxBatchSize(16);
+    isExecuting.emplace_back(new std::atomic<bool>{false});
+  }
+  for (int action = 0; action < kNumActions; ++action) {
+    for (int i = 0; i < kNumStrands; ++i) {
+      strands[i]->push([&, i, action] {
+        if (isExecuting[i]->exchange(true) || counters[i] != action) {
+          isSerial.store(false);
+        }
+        ++counters[i];
+        isExecuting[i]->store(false);
+        if (numExecuted.fetch_add(1) + 1 == kNumStrands * kNumActions) {
+          allExecuted.set_value();
+        }
+      });
+    }
+  }
+  allExecutedFuture.wait();
+
+  EXPECT_TRUE(isSerial.load());
+  for (int i = 0; i < kNumStrands; ++i) {
+    EXPECT_EQ(counters[i], kNumActions);
+  }
+}
+
+TEST(StrandContextTest, Invoke_FromStrand_ExecutedInPlace)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(2);
+  auto strand = icc::ContextBuilder::createContext(threadPool);
+  auto channel = strand->createChannel();
+  std::promise<std::vector<int>> result;
+  channel->push([&] {
+    std::vector<int> order;
+    strand->invoke([&order] {
+      order.push_back(1);
+    });
+    order.push_back(2);
+    result.set_value(order);
+  });
+
+  EXPECT_EQ(result.get_future().get(), std::vector<int>({1, 2}));
+}
+
+TEST(StrandContextTest, Timers_DelayedAndPeriodicActions_AreExecutedOnStrand)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(4);
+  auto strand = icc::ContextBuilder::createContext(threadPool);
+  auto channel = strand->createChannel();
+  std::vector<int> executed;
+  std::atomic<bool> isSerial{true};
+  std::atomic<bool> isExecuting{false};
+  int numTicks = 0;
+  icc::TimerHandle ticker;
+  std::promise<void> finished;
+  channel->pushAfter(std::chrono::milliseconds(10), [&] {
+    executed.push_back(1);
+  });
+  channel->pushAfter(std::chrono::milliseconds(30), [&] {
+    executed.push_back(2);
+  });
+  ticker = channel->pushEvery(std::chrono::milliseconds(1), [&] {
+    if (isExecuting.exchange(true)) {
+      isSerial.store(false);
+    }
+    if (++numTicks == 10) {
+      ticker.cancel();
+    }
+    isExecuting.store(false);
+  });
+  channel->pushAt(icc::TimerClock::now() + std::chrono::milliseconds(60), [&] {
+    finished.set_value();
+  });
+  finished.get_future().wait();
+
+  EXPECT_TRUE(isSerial.load());
+  EXPECT_EQ(executed, std::vector<int>({1, 2}));
+  EXPECT_EQ(numTicks, 10);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file TaskTests.cpp
+ * @author Denis Kotov
+ * @date 17 Oct 2026
+ * @brief Contains tests for Task class
+ * @copyright Denis Kotov, MIT License. Open source: https://github.com/redradist/Inter-Component-Communication.git
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <icc/threadpool/Task.hpp>
+
+using namespace std::chrono_literals;
+
+TEST(TaskTest, FanOutFanIn_ContinuationsAndWhenAll_Success)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(2);
+  auto root = threadPool->createTask<int>([] {
+    return 10;
+  });
+  std::vector<icc::threadpool::Task<int>> branches;
+  for (int i = 1; i <= 3; ++i) {
+    branches.push_back(root.continueWith([i](int _value) {
+      return _value * i;
+    }));
+  }
+  std::promise<int> sum;
+  auto sumFuture = sum.get_future();
+  icc::threadpool::whenAll(branches).continueWith([&sum](const std::vector<int> &_values) {
+    sum.set_value(_values[0] + _values[1] + _values[2]);
+  });
+  root.start();
+
+  ASSERT_EQ(sumFuture.wait_for(10s), std::future_status::ready);
+  EXPECT_EQ(sumFuture.get(), 60);
+}
+
+TEST(TaskTest, ExceptionAndWhenAny_AreForwardedToContinuations)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(2);
+  auto failing = threadPool->createTask<int>([]() -> int {
+    throw std::runtime_error("Task failed");
+  });
+  std::promise<bool> isSkipped;
+  auto isSkippedFuture = isSkipped.get_future();
+  failing.continueWith([](int _value) {
+    return _value + 1;
+  }).continueWith([&isSkipped](int) {
+    isSkipped.set_value(false);
+  });
+  auto fast = threadPool->createTask<int>([] {
+    return 1;
+  });
+  std::promise<int> first;
+  auto firstFuture = first.get_future();
+  icc::threadpool::whenAny(std::vector<icc::threadpool::Task<int>>{fast})
+      .continueWith([&first](int _value) {
+    first.set_value(_value);
+  });
+  failing.start();
+  fast.start();
+
+  ASSERT_EQ(firstFuture.wait_for(10s), std::future_status::ready);
+  EXPECT_EQ(firstFuture.get(), 1);
+  EXPECT_EQ(isSkippedFuture.wait_for(100ms), std::future_status::timeout);
+}
+
+TEST(TaskTest, Cancellation_QueuedAndCooperativeTasks_AreCompleted)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(2);
+  icc::threadpool::CancellationSource source;
+  auto token = source.token();
+  std::atomic<bool> isStarted{false};
+  auto longTask = threadPool->createTask<void>([token, &isStarted] {
+    isStarted = true;
+    for (;;) {
+      token.throwIfCancelled();
+      std::this_thread::sleep_for(1ms);
+    }
+  });
+  longTask.setCancellationToken(token);
+  longTask.start();
+  while (!isStarted) {
+    std::this_thread::sleep_for(1ms);
+  }
+  source.cancel();
+
+  std::atomic<bool> isExecuted{false};
+  auto queued = threadPool->createTask<int>([&isExecuted] {
+    isExecuted = true;
+    return 1;
+  });
+  queued.setCancellationToken(token).setPriority(icc::threadpool::Priority::High);
+  queued.start();
+
+  for (int i = 0; i < 1000 && !(longTask.isCompleted() && queued.isCompleted()); ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_TRUE(longTask.isCompleted());
+  EXPECT_TRUE(queued.isCompleted());
+  EXPECT_FALSE(isExecuted);
+}
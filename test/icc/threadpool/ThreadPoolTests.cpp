@@ -7,6 +7,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <future>
 #include <unordered_set>
 
 #include <icc/threadpool/ThreadPool.hpp>
@@ -76,4 +77,226 @@ TEST_F(ThreadPoolTest, HundredMoreJobs_ThreadPool_Success)
   });
   ASSERT_EQ(unique_threads.size(), hardware_concurrency_);
   ASSERT_EQ(numHandledJobs, numJobs);
-}
\ No newline at end of file
+}
+
+TEST_F(ThreadPoolTest, ForkJoin_WorkStealingThreadPool_Success)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(
+      4, icc::threadpool::SchedulingPolicy::WorkStealing);
+  std::mutex mtx;
+  std::condition_variable cond_var;
+  std::atomic<unsigned> numLeafJobs{0};
+  const unsigned kDepth = 14;
+  std::function<void(unsigned)> spawn = [&](unsigned _depth) {
+    if (_depth == 0) {
+      if (numLeafJobs.fetch_add(1) + 1 == (1u << kDepth)) {
+        std::lock_guard<std::mutex> lock{mtx};
+        cond_var.notify_one();
+      }
+      return;
+    }
+    threadPool->push([&spawn, _depth] { spawn(_depth - 1); });
+    threadPool->push([&spawn, _depth] { spawn(_depth - 1); });
+  };
+  threadPool->push([&spawn, kDepth] { spawn(kDepth); });
+  std::unique_lock<std::mutex> lock{mtx};
+  cond_var.wait_for(lock, 10s, [&numLeafJobs, kDepth] {
+    return numLeafJobs.load() == (1u << kDepth);
+  });
+  ASSERT_EQ(numLeafJobs.load(), 1u << kDepth);
+}
+
+TEST_F(ThreadPoolTest, PriorityAndCancellation_QueuedTasks_Success)
+{
+  for (auto policy : {icc::threadpool::SchedulingPolicy::SharedQueue,
+                      icc::threadpool::SchedulingPolicy::WorkStealing}) {
+    auto threadPool = icc::threadpool::ThreadPool::createPool(1, policy);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    threadPool->push([gateFuture] { gateFuture.wait(); });
+    std::mutex mtx;
+    std::vector<int> order;
+    auto record = [&mtx, &order](int _value) {
+      return [&mtx, &order, _value] {
+        std::lock_guard<std::mutex> lock{mtx};
+        order.push_back(_value);
+      };
+    };
+    icc::threadpool::CancellationSource source;
+    threadPool->push(record(3), icc::threadpool::Priority::Low);
+    threadPool->push(record(2));
+    threadPool->push(record(0), source.token());
+    threadPool->push(record(1), icc::threadpool::Priority::High);
+    std::promise<void> done;
+    threadPool->push([&done] { done.set_value(); }, icc::threadpool::Priority::Low);
+    source.cancel();
+    gate.set_value();
+
+    ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+    std::lock_guard<std::mutex> lock{mtx};
+    ASSERT_EQ(order, (std::vector<int>{1, 2, 3}));
+  }
+}
+
+TEST_F(ThreadPoolTest, Elastic_SpawnsOnLatencyAndBlockingAndRetiresIdle)
+{
+  icc::threadpool::ElasticOptions options;
+  options.min_threads_ = 1;
+  options.max_threads_ = 4;
+  options.max_queue_wait_ = 5ms;
+  options.idle_timeout_ = 100ms;
+  auto threadPool = icc::threadpool::ThreadPool::createElasticPool(options);
+
+  std::promise<void> unblock;
+  std::shared_future<void> unblockFuture = unblock.get_future().share();
+  std::promise<void> blockedDone;
+  threadPool->push([unblockFuture, &blockedDone] {
+    icc::threadpool::ThreadPool::BlockingScope scope;
+    unblockFuture.wait();
+    blockedDone.set_value();
+  });
+  threadPool->push([&unblock] { unblock.set_value(); });
+  ASSERT_EQ(blockedDone.get_future().wait_for(10s), std::future_status::ready);
+  EXPECT_GE(threadPool->stats().spawned_by_blocking_, 1u);
+
+  std::atomic<unsigned> numDone{0};
+  for (int i = 0; i < 4; ++i) {
+    threadPool->push([&numDone] {
+      std::this_thread::sleep_for(100ms);
+      ++numDone;
+    });
+  }
+  for (int i = 0; i < 1000 && numDone < 4; ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_EQ(numDone.load(), 4u);
+  auto stats = threadPool->stats();
+  EXPECT_TRUE(stats.elastic_);
+  EXPECT_GE(stats.peak_threads_, 3u);
+  EXPECT_LE(stats.peak_threads_, 4u);
+
+  for (int i = 0; i < 1000 && threadPool->size() > 1; ++i) {
+    std::this_thread::sleep_for(10ms);
+  }
+  stats = threadPool->stats();
+  EXPECT_EQ(stats.num_threads_, 1u);
+  EXPECT_GE(stats.retired_threads_, 1u);
+}
+
+TEST_F(ThreadPoolTest, Schedule_DelayedAndPeriodicWithOverrunPolicy_Success)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(1);
+  const auto kStart = std::chrono::steady_clock::now();
+  std::promise<std::chrono::steady_clock::time_point> delayed;
+  threadPool->scheduleAfter(20ms, [&delayed] {
+    delayed.set_value(std::chrono::steady_clock::now());
+  });
+  auto delayedFuture = delayed.get_future();
+  ASSERT_EQ(delayedFuture.wait_for(10s), std::future_status::ready);
+  EXPECT_GE(delayedFuture.get() - kStart, 20ms);
+
+  std::promise<void> gate;
+  std::shared_future<void> gateFuture = gate.get_future().share();
+  threadPool->push([gateFuture] { gateFuture.wait(); });
+  std::atomic<unsigned> numSkipRuns{0};
+  std::atomic<unsigned> numCatchUpRuns{0};
+  auto skip = threadPool->scheduleEvery(10ms, [&numSkipRuns] {
+    ++numSkipRuns;
+  });
+  auto catchUp = threadPool->scheduleEvery(10ms, [&numCatchUpRuns] {
+    ++numCatchUpRuns;
+  }, icc::threadpool::OverrunPolicy::CatchUp);
+  std::this_thread::sleep_for(150ms);
+  gate.set_value();
+  for (int i = 0; i < 1000 && numCatchUpRuns < 10; ++i) {
+    std::this_thread::sleep_for(1ms);
+  }
+  const unsigned kNumSkipRuns = numSkipRuns;
+  skip.cancel();
+  catchUp.cancel();
+  EXPECT_GE(numCatchUpRuns.load(), 10u);
+  EXPECT_LT(kNumSkipRuns, 5u);
+}
+
+TEST_F(ThreadPoolTest, Schedule_DuringStop_ReturnsEmptyHandle)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(1);
+  icc::threadpool::ThreadPool *const kPool = threadPool.get();
+  kPool->scheduleAfter(1h, [] {});
+  std::promise<void> started;
+  icc::threadpool::TimerHandle handle;
+  kPool->push([kPool, &started, &handle] {
+    started.set_value();
+    std::this_thread::sleep_for(50ms);
+    handle = kPool->scheduleAfter(1ms, [] {});
+  });
+  started.get_future().wait();
+  threadPool.reset();
+
+  EXPECT_FALSE(handle);
+}
+
+TEST_F(ThreadPoolTest, CustomPool_WholeThreadBodyBelongsToPool)
+{
+  std::promise<icc::threadpool::ThreadPool *> beforeLoop;
+  std::promise<icc::threadpool::ThreadPool *> afterLoop;
+  auto threadPool = icc::threadpool::ThreadPool::createCustomPool(
+  [&beforeLoop, &afterLoop](const icc::threadpool::ThreadPool::ThreadLoop &_threadLoop) {
+    beforeLoop.set_value(icc::threadpool::ThreadPool::current());
+    _threadLoop();
+    afterLoop.set_value(icc::threadpool::ThreadPool::current());
+  }, 1);
+  icc::threadpool::ThreadPool *const kPool = threadPool.get();
+  EXPECT_EQ(beforeLoop.get_future().get(), kPool);
+  threadPool.reset();
+
+  EXPECT_EQ(afterLoop.get_future().get(), kPool);
+}
+
+TEST_F(ThreadPoolTest, Dispatch_InPlaceOnPoolThreadWithDepthLimit_Success)
+{
+  auto threadPool = icc::threadpool::ThreadPool::createPool(2);
+  EXPECT_FALSE(threadPool->hasThread(std::this_thread::get_id()));
+  EXPECT_EQ(icc::threadpool::ThreadPool::current(), nullptr);
+
+  std::promise<std::vector<int>> order;
+  threadPool->push([&threadPool, &order] {
+    EXPECT_TRUE(threadPool->hasThread(std::this_thread::get_id()));
+    EXPECT_EQ(icc::threadpool::ThreadPool::current(), threadPool.get());
+    std::vector<int> values;
+    threadPool->dispatch([&values] {
+      values.push_back(1);
+    });
+    values.push_back(2);
+    order.set_value(values);
+  });
+  EXPECT_EQ(order.get_future().get(), (std::vector<int>{1, 2}));
+
+  const unsigned kNumNested = 100;
+  static thread_local unsigned tDepth = 0;
+  std::atomic<unsigned> numExecuted{0};
+  std::atomic<unsigned> maxDepth{0};
+  std::promise<void> done;
+  std::function<void(unsigned)> nest = [&](unsigned _level) {
+    ++tDepth;
+    ++numExecuted;
+    if (tDepth > maxDepth) {
+      maxDepth = tDepth;
+    }
+    if (_level < kNumNested) {
+      threadPool->dispatch([&nest, _level] { nest(_level + 1); });
+    } else {
+      done.set_value();
+    }
+    --tDepth;
+  };
+  threadPool->push([&nest] {
+    nest(1);
+  });
+  ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+  // NOTE(redra): Joins threads, so all nested frames are unwound
+  threadPool.reset();
+  EXPECT_EQ(numExecuted.load(), kNumNested);
+  EXPECT_GT(maxDepth.load(), 1u);
+  EXPECT_LE(maxDepth.load(), icc::threadpool::ThreadPool::kMaxDispatchDepth + 1);
+}